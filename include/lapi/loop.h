@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Referred from linux kernel include/uapi/linux/loop.h
+ */
+#ifndef LAPI_LOOP_H
+#define LAPI_LOOP_H
+
+#include "config.h"
+#include <linux/types.h>
+#include <linux/loop.h>
+
+#ifndef LOOP_CTL_GET_FREE
+# define LOOP_CTL_GET_FREE	0x4C82
+#endif
+
+#ifndef LOOP_SET_DIRECT_IO
+# define LOOP_SET_DIRECT_IO	0x4C08
+#endif
+
+#ifndef LOOP_SET_BLOCK_SIZE
+# define LOOP_SET_BLOCK_SIZE	0x4C09
+#endif
+
+#ifndef LOOP_CONFIGURE
+# define LOOP_CONFIGURE		0x4C0A
+#endif
+
+#if !HAVE_DECL_LO_FLAGS_DIRECT_IO
+# define LO_FLAGS_DIRECT_IO	16
+#endif
+
+#ifndef HAVE_STRUCT_LOOP_CONFIG
+struct loop_config {
+	__u32			fd;
+	__u32			block_size;
+	struct loop_info64	info;
+	__u64			__reserved[8];
+};
+#endif
+
+#endif /* LAPI_LOOP_H */
@@ -0,0 +1,5 @@
+# Parameters from the top level configure
+CC=		gcc
+CFLAGS+=	-g -O2 -fcommon
+LDLIBS+=	
+LDFLAGS+=	
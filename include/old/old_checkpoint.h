@@ -56,4 +56,10 @@
         tst_safe_checkpoint_wake(__FILE__, __LINE__, cleanup_fn, id, 1); \
         tst_safe_checkpoint_wait(__FILE__, __LINE__, cleanup_fn, id, 0);
 
+#define TST_SAFE_CHECKPOINT_BARRIER(cleanup_fn, id, nr) \
+        tst_safe_checkpoint_barrier(__FILE__, __LINE__, cleanup_fn, id, nr);
+
+#define TST_SAFE_CHECKPOINT_ID(cleanup_fn, name) \
+        tst_safe_checkpoint_id(__FILE__, __LINE__, cleanup_fn, name)
+
 #endif /* OLD_CHECKPOINT__ */
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+ /*
+
+    Benchmark library.
+
+    The test defines a function that does one iteration of the operation to be
+    measured and sets it in the tst_test structure, the library runs the
+    warmup, takes the samples and computes the statistics.
+
+    static void bench(void)
+    {
+	// One iteration of the measured operation
+    }
+
+    static struct tst_test test = {
+	.bench = bench,
+	.bench_iterations = 10000,
+    };
+
+    The number of samples is either fixed by .bench_iterations or limited by
+    .bench_time_ms time budget, if both are set whichever is reached first
+    stops the sampling. If none is set default number of iterations is used.
+
+    If LTP_BENCH_OUTPUT is set in the environment the statistics are appended
+    to that file as a single line JSON object.
+
+    If LTP_BENCH_STORE is set the samples are also kept in a results store
+    and compared against a baseline, see tst_bench_store() below.
+
+  */
+
+#ifndef TST_BENCH_H__
+#define TST_BENCH_H__
+
+struct tst_bench_stats {
+	unsigned int samples;
+	/* outliers left out from mean and stddev */
+	unsigned int discarded;
+	long long min;
+	long long median;
+	long long p99;
+	long long max;
+	double mean;
+	double stddev;
+	/* mean of all samples including the outliers */
+	double raw_mean;
+};
+
+/*
+ * Sorts the samples and computes statistics, outliers above the upper
+ * Tukey's fence, i.e. q3 + 3 * (q3 - q1) but at least q3 + q3 / 10, are not
+ * accounted into the mean and standard deviation, the order statistics and
+ * raw_mean are computed from all samples.
+ */
+void tst_bench_stats(long long *samples, unsigned int nsamples,
+		     struct tst_bench_stats *stats);
+
+struct tst_histogram;
+
+/*
+ * Merges the samples into $LTP_BENCH_STORE/<host>/<kernel release>/<TCID>.<metric>
+ * and appends a summary line to $LTP_BENCH_STORE/results. Does nothing
+ * unless LTP_BENCH_STORE is set.
+ *
+ * If LTP_BENCH_BASELINE is set to a kernel release the samples are compared
+ * against the ones stored for that release on this host with one sided
+ * Mann-Whitney U test. A significant slowdown of the median above the
+ * thresholds set by LTP_BENCH_THRESHOLD is reported as TWARN or TFAIL.
+ *
+ * Used by tst_bench and tst_timer_test, the metric names the measured
+ * quantity, e.g. "1000us" for timer tests.
+ */
+void tst_bench_store(const char *metric, const struct tst_histogram *h);
+
+# ifdef TST_NO_DEFAULT_MAIN
+struct tst_test *tst_bench_setup(struct tst_test *test);
+
+/*
+ * Parses LTP_BENCH_THRESHOLD, called at the test setup so that an invalid
+ * value is rejected before the samples are taken.
+ */
+void tst_bench_parse_threshold(void);
+# endif /* TST_NO_DEFAULT_MAIN */
+#endif /* TST_BENCH_H__ */
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Transient cgroup v2 leaf for each test run, used by the test library when
+ * LTP_CGROUP is set.
+ *
+ * LTP_CGROUP is either a path to a cgroup v2 directory the leaves are created
+ * under, or any other value to use the cgroup the test was started in. The
+ * cpu, memory, io and pids controllers are enabled for the leaves if
+ * possible, which needs the parent cgroup to be delegated, i.e. to have no
+ * processes of its own.
+ *
+ * The test process joins the leaf right after fork(), so everything it
+ * starts is accounted there and killed with it. After the test process has
+ * been reaped the leftovers are killed, cpu.stat, memory.peak, io.stat and
+ * pids.peak are reported and the leaf is removed.
+ */
+
+#ifndef TST_CGROUP_H__
+#define TST_CGROUP_H__
+
+struct tst_test;
+
+/*
+ * Finds the parent cgroup and enables the controllers, returns non-zero if
+ * LTP_CGROUP is not set or cgroup v2 is not usable.
+ */
+int tst_cgroup_init(void);
+
+/*
+ * Creates a leaf for the next test run and applies the cgroup_* limits from
+ * the test structure.
+ */
+void tst_cgroup_create(const struct tst_test *test);
+
+/*
+ * Moves the calling process into the leaf, called by the test process.
+ */
+void tst_cgroup_join(void);
+
+/*
+ * Kills all processes in the leaf, async signal safe.
+ */
+void tst_cgroup_kill(void);
+
+/*
+ * Kills the leftovers, reports the statistics and removes the leaf.
+ */
+void tst_cgroup_destroy(void);
+
+#endif /* TST_CGROUP_H__ */
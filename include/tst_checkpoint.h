@@ -36,6 +36,12 @@
         tst_safe_checkpoint_wake(__FILE__, __LINE__, NULL, id, 1); \
         tst_safe_checkpoint_wait(__FILE__, __LINE__, NULL, id, 0);
 
+#define TST_CHECKPOINT_BARRIER(id, nr) \
+        tst_safe_checkpoint_barrier(__FILE__, __LINE__, NULL, id, nr);
+
+#define TST_CHECKPOINT_ID(name) \
+        tst_safe_checkpoint_id(__FILE__, __LINE__, NULL, name)
+
 extern const char *tst_ipc_path;
 
 #endif /* TST_CHECKPOINT__ */
@@ -18,6 +18,8 @@
 #ifndef TST_CHECKPOINT_FN__
 #define TST_CHECKPOINT_FN__
 
+#define TST_CHECKPOINT_NAME_MAX 28
+
 /*
  * Checkpoint initializaton, must be done first.
  *
@@ -35,7 +37,8 @@ void tst_checkpoint_init(const char *file, const int lineno,
 int tst_checkpoint_wait(unsigned int id, unsigned int msec_timeout);
 
 /*
- * Wakes up sleeping process(es)/thread(s).
+ * Wakes up sleeping process(es)/thread(s), waits for nr_wake waiters to
+ * arrive at the checkpoint first.
  *
  * @id: Checkpoint id, possitive number
  * @nr_wake: Number of processes/threads to wake up
@@ -44,6 +47,36 @@ int tst_checkpoint_wait(unsigned int id, unsigned int msec_timeout);
 int tst_checkpoint_wake(unsigned int id, unsigned int nr_wake,
                         unsigned int msec_timeout);
 
+/*
+ * Waits until nr processes/threads have arrived at the barrier, the barrier
+ * can be reused as long as all participants pass the same nr. Don't mix
+ * barrier and wait/wake calls on a single checkpoint id.
+ *
+ * @id: Checkpoint id, possitive number
+ * @nr: Number of processes/threads to wait for, including the caller
+ * @msec_timeout: Timeout in miliseconds
+ */
+int tst_checkpoint_barrier(unsigned int id, unsigned int nr,
+			   unsigned int msec_timeout);
+
+/*
+ * Translates a name into a checkpoint id, all processes that share the
+ * checkpoint area get the same id for the same name. The named ids are
+ * allocated from the top of the id space, numeric ids used by the test must
+ * stay small, or below the nr_checkpoints the area was sized for with
+ * tst_checkpoint_futexes().
+ *
+ * Returns the id, or -1 and sets errno to ENAMETOOLONG if the name does not
+ * fit into TST_CHECKPOINT_NAME_MAX, or ENOSPC if the name table is full.
+ */
+int tst_checkpoint_id(const char *name);
+
+/*
+ * Number of futexes the checkpoint area needs for nr_checkpoints ids, used by
+ * the test library to size the area.
+ */
+unsigned int tst_checkpoint_futexes(unsigned int nr_checkpoints);
+
 void tst_safe_checkpoint_wait(const char *file, const int lineno,
                               void (*cleanup_fn)(void), unsigned int id,
 			      unsigned int msec_timeout);
@@ -52,4 +85,11 @@ void tst_safe_checkpoint_wake(const char *file, const int lineno,
                               void (*cleanup_fn)(void), unsigned int id,
                               unsigned int nr_wake);
 
+void tst_safe_checkpoint_barrier(const char *file, const int lineno,
+                                 void (*cleanup_fn)(void), unsigned int id,
+                                 unsigned int nr);
+
+unsigned int tst_safe_checkpoint_id(const char *file, const int lineno,
+                                    void (*cleanup_fn)(void), const char *name);
+
 #endif /* TST_CHECKPOINT_FN__ */
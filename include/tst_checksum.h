@@ -13,4 +13,42 @@
  */
 uint32_t tst_crc32c(uint8_t *buf, size_t buf_len);
 
+/*
+ * Streaming CRC32c, for data that does not fit into a single buffer:
+ *
+ * struct tst_crc32c ctx;
+ *
+ * tst_crc32c_init(&ctx);
+ * while ((len = read(fd, buf, sizeof(buf))) > 0)
+ *	tst_crc32c_update(&ctx, buf, len);
+ * crc = tst_crc32c_final(&ctx);
+ */
+struct tst_crc32c {
+	uint32_t crc;
+};
+
+void tst_crc32c_init(struct tst_crc32c *ctx);
+void tst_crc32c_update(struct tst_crc32c *ctx, const void *buf, size_t len);
+uint32_t tst_crc32c_final(struct tst_crc32c *ctx);
+
+/*
+ * By default the CRC32 instruction (SSE4.2 on x86, CRC extension on ARMv8)
+ * is used if the CPU has it, slicing-by-8 tables otherwise. The
+ * implementation can be forced, mostly for testing and benchmarking.
+ */
+enum tst_crc32c_impl {
+	TST_CRC32C_AUTO,
+	/* One table lookup per byte */
+	TST_CRC32C_TABLE,
+	/* Eight table lookups per eight bytes */
+	TST_CRC32C_SLICE8,
+	/* CRC32 instruction */
+	TST_CRC32C_HW,
+};
+
+/* Returns non-zero if the implementation is not supported */
+int tst_crc32c_set_impl(int impl);
+
+const char *tst_crc32c_impl_name(void);
+
 #endif
@@ -41,6 +41,7 @@
 #define TST_F2FS_MAGIC     0xF2F52010
 #define TST_NILFS_MAGIC    0x3434
 #define TST_EXOFS_MAGIC    0x5DF5
+#define TST_CGROUP2_MAGIC  0x63677270
 
 enum {
 	TST_BYTES = 1,
@@ -171,6 +172,21 @@ const char **tst_get_supported_fs_types(void);
  */
 void tst_fill_fs(const char *path, int verbose);
 
+enum tst_fill_mode {
+	/* Fill the data blocks */
+	TST_FILL_BLOCKS,
+	/* Create empty files until inodes are exhausted */
+	TST_FILL_INODES,
+};
+
+/*
+ * Fills the filesystem on given path until percent of the blocks or inodes
+ * are used, 100 means until ENOSPC. Most of the space is preallocated with
+ * fallocate() if supported, the rest is written by a thread per CPU. Reports
+ * the fill throughput. Tests using it need to be linked with -pthread.
+ */
+void tst_fill_fs_target(const char *path, unsigned int percent, int mode);
+
 #ifdef TST_TEST_H__
 static inline long tst_fs_type(const char *path)
 {
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Kernel trace capture for failing and slow test runs, enabled by LTP_FTRACE.
+ *
+ * LTP_FTRACE is a comma separated list of trace events, as accepted by the
+ * set_event file, e.g. "sched:sched_switch,irq:*", and optionally one tracer
+ * with a function filter, e.g. "function=vfs_*".
+ *
+ * Before each test run a tracing instance with its own per-CPU ring buffer is
+ * set up, limited to the test process and its children. The buffer is saved
+ * into a file only if the test run failed, broke, timed out or took longer
+ * than LTP_FTRACE_SLOW milliseconds, passing runs only pay for the tracing.
+ *
+ * Tracers that are not supported in instances use the top level buffer, but
+ * only if it's not used by anybody else, otherwise only events are traced.
+ */
+
+#ifndef TST_FTRACE_H__
+#define TST_FTRACE_H__
+
+#include <sys/types.h>
+
+/*
+ * Parses LTP_FTRACE and finds tracefs, returns non-zero if disabled.
+ */
+int tst_ftrace_init(void);
+
+/*
+ * Sets up the tracing instance, called before the test process is forked.
+ */
+void tst_ftrace_arm(void);
+
+/*
+ * Limits the tracing to the test process and starts it, called before the
+ * test process is let to run.
+ */
+void tst_ftrace_start(pid_t pid);
+
+/*
+ * Stops the tracing, saves the buffer if the run failed or was slow and
+ * tears the instance down.
+ */
+void tst_ftrace_stop(int failed);
+
+#endif /* TST_FTRACE_H__ */
@@ -12,9 +12,11 @@
  * and therefore impossible to mark accurately, the library may add randomised
  * delays to either thread in order to help find the exact race timing.
  *
- * Currently only two way races are explicitly supported, that is races
- * involving two threads or processes. We refer to the main test thread as
- * thread A and the child thread as thread B.
+ * The races are between N participants, threads or processes, where N is
+ * at least two. Two way races are the most common and have their own API
+ * described below, we refer to the main test thread as thread A and the
+ * child thread as thread B. The N way API is described at the end of this
+ * comment.
  *
  * In each thread you need a simple while- or for-loop which the tst_fzsync_*
  * functions are called in. In the simplest case thread A will look something
@@ -47,7 +49,7 @@
  * one by iteration count. The user can use the -i parameter to run the test
  * multiple times or LTP_TIMEOUT_MUL to give the test more time.
  *
- * It is possible to use the library just for tst_fzsync_pair_wait() to get a
+ * It is possible to use the library just for tst_fzsync_wait_a/b() to get a
  * basic spin wait. However if you are actually testing a race condition then
  * it is recommended to use tst_fzsync_start_race_a/b even if the
  * randomisation is not needed. It provides some semantic information which
@@ -56,15 +58,59 @@
  * For a usage example see testcases/cve/cve-2016-7117.c or just run
  * 'git grep tst_fuzzy_sync.h'
  *
- * @sa tst_fzsync_pair
+ * For races that need more than two actors set the number of participants
+ * before calling tst_fzsync_group_init(). The main test thread is participant
+ * 0 and the function passed to tst_fzsync_group_reset() is started for each
+ * of the participants 1 to N-1 with the participant number cast to the
+ * (void *) argument:
+ *
+ * static struct tst_fzsync_group group = {.participants = 3};
+ *
+ * static void *run(void *arg)
+ * {
+ *	int i = (long)arg;
+ *
+ *	while (tst_fzsync_group_run(&group, i)) {
+ *		tst_fzsync_group_start_race(&group, i);
+ *		// Do something that races with the other participants
+ *		tst_fzsync_group_end_race(&group, i);
+ *	}
+ *
+ *	return NULL;
+ * }
+ *
+ * The main thread runs the same loop with i = 0. Each participant gets its
+ * own random delay and timing statistics.
+ *
+ * If the race needs separate address spaces set .processes = 1, the
+ * participants are then forked instead of started as threads. In that case
+ * the group must be placed in shared memory, e.g. allocated with
+ * SAFE_MMAP() with MAP_SHARED | MAP_ANONYMOUS, and the test has to set
+ * .forks_child.
+ *
+ * The participants can be pinned to CPUs picked from the sysfs topology by
+ * setting .placement (or LTP_FZSYNC_PLACEMENT) to SMT siblings of one core,
+ * different cores sharing the last level cache or different packages, see
+ * tst_fzsync_place.h. The rotate placement switches between all of these
+ * and no pinning on each iteration and the window overlap achieved with each
+ * of them is reported at the end.
+ *
+ * @sa tst_fzsync_group tst_fzsync_pair
  */
 
 #include <sys/time.h>
+#include <sys/wait.h>
 #include <time.h>
 #include <math.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
 #include "tst_atomic.h"
+#include "tst_cpu.h"
+#include "tst_fzsync_place.h"
 #include "tst_timer.h"
+#include "tst_tsc.h"
 #include "tst_safe_pthread.h"
 
 #ifndef TST_FUZZY_SYNC_H__
@@ -73,6 +119,9 @@
 /* how much of exec time is sampling allowed to take */
 #define SAMPLING_SLICE 0.5f
 
+/* maximal number of participants in a race */
+#define TST_FZSYNC_MAX_PARTICIPANTS 8
+
 /** Some statistics for a variable */
 struct tst_fzsync_stat {
 	float avg;
@@ -81,51 +130,81 @@ struct tst_fzsync_stat {
 };
 
 /**
- * The state of a two way synchronisation or race.
+ * The state of a single participant of a race.
+ *
+ * All fields are internal, the times are written by the participant itself
+ * and the statistics and delay are maintained by participant 0.
+ */
+struct tst_fzsync_participant {
+	/** Start time of the race in this participant */
+	struct timespec start;
+	/** End time of the race in this participant */
+	struct timespec end;
+	/** Avg. difference between start and start of participant 0 */
+	struct tst_fzsync_stat diff_s;
+	/** Avg. difference between end and start */
+	struct tst_fzsync_stat diff_se;
+	/** Avg. difference between end and end of participant 0 */
+	struct tst_fzsync_stat diff_e;
+	/** Number of spins while waiting for the slower participants */
+	int spins;
+	/** Number of spins to delay the start of the race */
+	int delay;
+	/** Added to the delay, positive delays this participant */
+	int delay_bias;
+	/** diff_se and diff_e loaded from the calibration cache */
+	struct tst_fzsync_stat cached_se;
+	struct tst_fzsync_stat cached_e;
+	/** The placement the participant is pinned by */
+	int placed;
+};
+
+/** Race window overlap statistics of a CPU placement */
+struct tst_fzsync_place_stat {
+	/** Number of iterations run with the placement */
+	int loops;
+	/** Number of iterations where all race windows overlapped */
+	int overlaps;
+	/** Sum of the overlap lengths */
+	long long overlap_ns;
+};
+
+/**
+ * The state of an N way synchronisation or race.
  *
- * This contains all the necessary state for approximately synchronising two
- * sections of code in different threads.
+ * This contains all the necessary state for approximately synchronising
+ * sections of code in different threads or processes.
  *
  * Some of the fields can be configured before calling
- * tst_fzsync_pair_reset(), however this is mainly for debugging purposes. If
+ * tst_fzsync_group_reset(), however this is mainly for debugging purposes. If
  * a test requires one of the parameters to be modified, we should consider
  * finding a way of automatically selecting an appropriate value at runtime.
  *
  * Internal fields should only be accessed by library functions.
  */
-struct tst_fzsync_pair {
+struct tst_fzsync_group {
+	/**
+	 * Number of threads or processes taking part in the race
+	 *
+	 * Defaults to 2.
+	 */
+	int participants;
+	/**
+	 * If set the participants 1 to N-1 are processes instead of threads
+	 *
+	 * The structure must be placed in shared memory.
+	 */
+	int processes;
 	/**
 	 * The rate at which old diff samples are forgotten
 	 *
 	 * Defaults to 0.25.
 	 */
 	float avg_alpha;
-	/** Internal; Thread A start time */
-	struct timespec a_start;
-	/** Internal; Thread B start time */
-	struct timespec b_start;
-	/** Internal; Thread A end time */
-	struct timespec a_end;
-	/** Internal; Thread B end time */
-	struct timespec b_end;
-	/** Internal; Avg. difference between a_start and b_start */
-	struct tst_fzsync_stat diff_ss;
-	/** Internal; Avg. difference between a_start and a_end */
-	struct tst_fzsync_stat diff_sa;
-	/** Internal; Avg. difference between b_start and b_end */
-	struct tst_fzsync_stat diff_sb;
-	/** Internal; Avg. difference between a_end and b_end */
-	struct tst_fzsync_stat diff_ab;
-	/** Internal; Number of spins while waiting for the slower thread */
-	int spins;
+	/** Internal; Per participant state */
+	struct tst_fzsync_participant part[TST_FZSYNC_MAX_PARTICIPANTS];
+	/** Internal; Avg. sum of spins of all participants */
 	struct tst_fzsync_stat spins_avg;
-	/**
-	 * Internal; Number of spins to use in the delay.
-	 *
-	 * A negative value delays thread A and a positive delays thread B.
-	 */
-	int delay;
-	int delay_bias;
 	/**
 	 *  Internal; The number of samples left or the sampling state.
 	 *
@@ -133,6 +212,10 @@ struct tst_fzsync_pair {
 	 *  samples. Zero or a negative indicate some other state.
 	 */
 	int sampling;
+	/** Internal; Set if the statistics were loaded from the cache */
+	int cached;
+	/** Internal; The race site of the cache entry */
+	int cache_site;
 	/**
 	 * The Minimum number of statistical samples which must be collected.
 	 *
@@ -152,12 +235,27 @@ struct tst_fzsync_pair {
 	 */
 	float max_dev_ratio;
 
-	/** Internal; Atomic counter used by fzsync_pair_wait() */
-	int a_cntr;
-	/** Internal; Atomic counter used by fzsync_pair_wait() */
-	int b_cntr;
-	/** Internal; Used by tst_fzsync_pair_exit() and fzsync_pair_wait() */
+	/** Internal; Number of participants that arrived at the barrier */
+	int cntr;
+	/** Internal; Incremented each time the barrier is passed */
+	int gen;
+	/** Internal; Used by tst_fzsync_group_cleanup() and run functions */
 	int exit;
+	/** Internal; Set when there are more participants than online CPUs */
+	int yield;
+	/**
+	 * CPU placement of the participants, enum tst_fzsync_placement
+	 *
+	 * Defaults to the LTP_FZSYNC_PLACEMENT environment variable, i.e.
+	 * 'smt', 'llc', 'cross' or 'rotate', or no pinning if not set.
+	 */
+	int placement;
+	/** Internal; Bitmask of placements possible on this machine */
+	int place_ok;
+	/** Internal; The placement used for the current iteration */
+	int place_cur;
+	/** Internal; Window overlap statistics per placement */
+	struct tst_fzsync_place_stat place_stat[TST_FZSYNC_PLACEMENTS];
 	/**
 	 * The maximum desired execution time as a proportion of the timeout
 	 *
@@ -167,7 +265,7 @@ struct tst_fzsync_pair {
 	 * Defaults to 0.5 (~150 seconds with default timeout).
 	 */
 	float exec_time_p;
-	/** Internal; The test time remaining on tst_fzsync_pair_reset() */
+	/** Internal; The test time remaining on tst_fzsync_group_reset() */
 	float exec_time_start;
 	/**
 	 * The maximum number of iterations to execute during the test
@@ -177,50 +275,92 @@ struct tst_fzsync_pair {
 	int exec_loops;
 	/** Internal; The current loop index  */
 	int exec_loop;
-	/** Internal; The second thread or 0 */
-	pthread_t thread_b;
+	/** Internal; The started threads or 0 */
+	pthread_t threads[TST_FZSYNC_MAX_PARTICIPANTS];
+	/** Internal; The started processes or 0 */
+	pid_t pids[TST_FZSYNC_MAX_PARTICIPANTS];
 };
 
+/*
+ * Calibration cache, implemented in lib/tst_fzsync_cache.c
+ *
+ * If LTP_FZSYNC_CACHE is set, the statistics and delay biases gathered in the
+ * sampling phase are stored there once random delays are introduced and
+ * loaded by tst_fzsync_group_reset() of the next run with the same test name,
+ * race site, number of participants, CPU model and kernel release.
+ *
+ * A loaded entry is validated by a short sampling period, if the fresh
+ * statistics disagree with the cached ones the full sampling is done and the
+ * entry is replaced.
+ */
+#define TST_FZSYNC_CACHE_NVALS(participants) (3 + 10 * (participants))
+#define TST_FZSYNC_VALIDATE_SAMPLES 64
+
+int tst_fzsync_cache_site(void);
+int tst_fzsync_cache_load(int site, int participants, float *vals,
+			  unsigned int nvals);
+void tst_fzsync_cache_store(int site, int participants, const float *vals,
+			    unsigned int nvals);
+
 #define CHK(param, low, hi, def) do {					      \
-	pair->param = (pair->param ? pair->param : def);		      \
-	if (pair->param < low)						      \
+	group->param = (group->param ? group->param : def);		      \
+	if (group->param < low)						      \
 		tst_brk(TBROK, #param " is less than the lower bound " #low); \
-	if (pair->param > hi)						      \
+	if (group->param > hi)						      \
 		tst_brk(TBROK, #param " is more than the upper bound " #hi);  \
 	} while (0)
 /**
  * Ensures that any Fuzzy Sync parameters are properly set
  *
- * @relates tst_fzsync_pair
+ * @relates tst_fzsync_group
  *
  * Usually called from the setup function, it sets default parameter values or
  * validates any existing non-defaults.
  *
- * @sa tst_fzsync_pair_reset()
+ * @sa tst_fzsync_group_reset()
  */
-static void tst_fzsync_pair_init(struct tst_fzsync_pair *pair)
+static void tst_fzsync_group_init(struct tst_fzsync_group *group)
 {
+	CHK(participants, 2, TST_FZSYNC_MAX_PARTICIPANTS, 2);
 	CHK(avg_alpha, 0, 1, 0.25);
 	CHK(min_samples, 20, INT_MAX, 1024);
 	CHK(max_dev_ratio, 0, 1, 0.1);
 	CHK(exec_time_p, 0, 1, 0.5);
 	CHK(exec_loops, 20, INT_MAX, 3000000);
+
+	group->yield = group->participants > tst_ncpus();
+
+	if (!group->placement)
+		group->placement = tst_fzsync_place_env();
+
+	if (group->placement < 0 || group->placement > TST_FZSYNC_PLACE_ROTATE)
+		tst_brk(TBROK, "Invalid fzsync placement %i", group->placement);
 }
 #undef CHK
 
 /**
- * Exit and join thread B if necessary.
+ * Exit and join the participants if necessary.
  *
- * @relates tst_fzsync_pair
+ * @relates tst_fzsync_group
  *
  * Call this from your cleanup function.
  */
-static void tst_fzsync_pair_cleanup(struct tst_fzsync_pair *pair)
+static void tst_fzsync_group_cleanup(struct tst_fzsync_group *group)
 {
-	if (pair->thread_b) {
-		tst_atomic_store(1, &pair->exit);
-		SAFE_PTHREAD_JOIN(pair->thread_b, NULL);
-		pair->thread_b = 0;
+	int i;
+
+	tst_atomic_store(1, &group->exit);
+
+	for (i = 1; i < TST_FZSYNC_MAX_PARTICIPANTS; i++) {
+		if (group->threads[i]) {
+			SAFE_PTHREAD_JOIN(group->threads[i], NULL);
+			group->threads[i] = 0;
+		}
+
+		if (group->pids[i]) {
+			SAFE_WAITPID(group->pids[i], NULL, 0);
+			group->pids[i] = 0;
+		}
 	}
 }
 
@@ -235,46 +375,279 @@ static void tst_init_stat(struct tst_fzsync_stat *s)
 	s->avg_dev = 0;
 }
 
+static void tst_fzsync_cache_stat(struct tst_fzsync_stat *s, float *vals,
+				  int load)
+{
+	if (load) {
+		s->avg = vals[0];
+		s->avg_dev = vals[1];
+		s->dev_ratio = vals[2];
+	} else {
+		vals[0] = s->avg;
+		vals[1] = s->avg_dev;
+		vals[2] = s->dev_ratio;
+	}
+}
+
+/**
+ * Copy the sampling results between the group and the cache values
+ *
+ * @relates tst_fzsync_group
+ * @param load If set the group is filled from vals, vals from group otherwise
+ */
+static void tst_fzsync_cache_copy(struct tst_fzsync_group *group, float *vals,
+				  int load)
+{
+	struct tst_fzsync_participant *part;
+	int i;
+
+	tst_fzsync_cache_stat(&group->spins_avg, vals, load);
+	vals += 3;
+
+	for (i = 0; i < group->participants; i++) {
+		part = &group->part[i];
+
+		tst_fzsync_cache_stat(&part->diff_s, vals, load);
+		tst_fzsync_cache_stat(&part->diff_se, vals + 3, load);
+		tst_fzsync_cache_stat(&part->diff_e, vals + 6, load);
+
+		if (load)
+			part->delay_bias = vals[9];
+		else
+			vals[9] = part->delay_bias;
+
+		vals += 10;
+	}
+}
+
+static void tst_fzsync_cache_save(struct tst_fzsync_group *group)
+{
+	float vals[TST_FZSYNC_CACHE_NVALS(TST_FZSYNC_MAX_PARTICIPANTS)];
+
+	tst_fzsync_cache_copy(group, vals, 0);
+	tst_fzsync_cache_store(group->cache_site, group->participants, vals,
+			       TST_FZSYNC_CACHE_NVALS(group->participants));
+}
+
+/**
+ * Pick the CPUs for the placement
+ *
+ * @relates tst_fzsync_group
+ */
+static void tst_fzsync_place_reset(struct tst_fzsync_group *group)
+{
+	char cpus[64];
+	int i, p, pos;
+
+	memset(group->place_stat, 0, sizeof(group->place_stat));
+	group->place_cur = TST_FZSYNC_PLACE_NONE;
+
+	for (i = 0; i < group->participants; i++)
+		group->part[i].placed = TST_FZSYNC_PLACE_NONE;
+
+	if (!group->placement)
+		return;
+
+	group->place_ok = tst_fzsync_place_init(group->participants);
+
+	for (p = 1; p < TST_FZSYNC_PLACEMENTS; p++) {
+		if (group->placement != TST_FZSYNC_PLACE_ROTATE
+		    && group->placement != p)
+			continue;
+
+		if (!(group->place_ok & (1 << p))) {
+			tst_res(TINFO, "CPU placement %s not possible",
+				tst_fzsync_place_name(p));
+			continue;
+		}
+
+		for (i = 0, pos = 0; i < group->participants; i++) {
+			pos += snprintf(cpus + pos, sizeof(cpus) - pos, "%s%i",
+					i ? "," : "", tst_fzsync_place_cpu(p, i));
+		}
+
+		tst_res(TINFO, "CPU placement %s uses CPUs %s",
+			tst_fzsync_place_name(p), cpus);
+	}
+
+	if (group->place_ok & (1 << group->placement))
+		group->place_cur = group->placement;
+}
+
+/**
+ * Account the race window overlap of the last iteration and pick the
+ * placement for the next one
+ *
+ * @relates tst_fzsync_group
+ */
+static void tst_fzsync_place_update(struct tst_fzsync_group *group)
+{
+	struct tst_fzsync_place_stat *stat;
+	struct timespec start, end;
+	int i, next;
+
+	stat = &group->place_stat[group->place_cur];
+	start = group->part[0].start;
+	end = group->part[0].end;
+
+	for (i = 1; i < group->participants; i++) {
+		if (tst_timespec_lt(start, group->part[i].start))
+			start = group->part[i].start;
+		if (tst_timespec_lt(group->part[i].end, end))
+			end = group->part[i].end;
+	}
+
+	stat->loops++;
+
+	if (tst_timespec_lt(start, end)) {
+		stat->overlaps++;
+		stat->overlap_ns += tst_timespec_diff_ns(end, start);
+	}
+
+	if (group->placement != TST_FZSYNC_PLACE_ROTATE)
+		return;
+
+	next = group->place_cur;
+	do {
+		next = (next + 1) % TST_FZSYNC_PLACEMENTS;
+	} while (!(group->place_ok & (1 << next)));
+
+	group->place_cur = next;
+}
+
+/**
+ * Pin participant i, called by the participant itself
+ *
+ * @relates tst_fzsync_group
+ */
+static inline void tst_fzsync_place_self(struct tst_fzsync_group *group,
+					 int i, int placement)
+{
+	if (group->part[i].placed == placement)
+		return;
+
+	tst_fzsync_place(placement, i);
+	group->part[i].placed = placement;
+}
+
+/**
+ * Print the window overlap for each placement used
+ *
+ * @relates tst_fzsync_group
+ */
+static void tst_fzsync_place_info(struct tst_fzsync_group *group)
+{
+	struct tst_fzsync_place_stat *stat;
+	float avg, best_avg = -1;
+	int p, best = 0;
+
+	for (p = 0; p < TST_FZSYNC_PLACEMENTS; p++) {
+		stat = &group->place_stat[p];
+
+		if (!stat->loops)
+			continue;
+
+		avg = (float)stat->overlap_ns / stat->loops;
+
+		tst_res(TINFO,
+			"placement %-5s: loops = %d, overlapped = %.1f%%, avg overlap = %.0fns",
+			tst_fzsync_place_name(p), stat->loops,
+			100.0 * stat->overlaps / stat->loops, avg);
+
+		if (avg > best_avg) {
+			best_avg = avg;
+			best = p;
+		}
+	}
+
+	if (group->placement == TST_FZSYNC_PLACE_ROTATE && best_avg >= 0) {
+		tst_res(TINFO, "Most window overlap with %s placement",
+			tst_fzsync_place_name(best));
+	}
+}
+
 /**
  * Reset or initialise fzsync.
  *
- * @relates tst_fzsync_pair
- * @param pair The state structure initialised with TST_FZSYNC_PAIR_INIT.
- * @param run_b The function defining thread B or NULL.
+ * @relates tst_fzsync_group
+ * @param group The state structure initialised with tst_fzsync_group_init().
+ * @param run The function defining participants 1 to N-1 or NULL.
+ *
+ * Call this from your main test function (participant 0), just before
+ * entering the main loop. It will (re)set any variables needed by fzsync and
+ * (re)start the other participants using the function provided, the
+ * participant number is passed as the argument.
  *
- * Call this from your main test function (thread A), just before entering the
- * main loop. It will (re)set any variables needed by fzsync and (re)start
- * thread B using the function provided.
+ * If a calibration cache entry for the test exists the sampling phase is
+ * shortened to a validation period, see LTP_FZSYNC_CACHE above.
  *
- * If you need to use fork or clone to start the second thread/process then
- * you can pass NULL to run_b and handle starting and stopping thread B
- * yourself. You may need to place tst_fzsync_pair in some shared memory as
- * well.
+ * If you need to start the other participants yourself you can pass NULL to
+ * run and handle starting and stopping them yourself. You may need to place
+ * tst_fzsync_group in some shared memory as well.
  *
- * @sa tst_fzsync_pair_init()
+ * @sa tst_fzsync_group_init()
  */
-static void tst_fzsync_pair_reset(struct tst_fzsync_pair *pair,
-				  void *(*run_b)(void *))
+static void tst_fzsync_group_reset(struct tst_fzsync_group *group,
+				   void *(*run)(void *))
 {
-	tst_fzsync_pair_cleanup(pair);
+	float vals[TST_FZSYNC_CACHE_NVALS(TST_FZSYNC_MAX_PARTICIPANTS)];
+	struct tst_fzsync_participant *part;
+	long i;
+
+	tst_fzsync_group_cleanup(group);
+
+	for (i = 0; i < group->participants; i++) {
+		part = &group->part[i];
+
+		tst_init_stat(&part->diff_s);
+		tst_init_stat(&part->diff_se);
+		tst_init_stat(&part->diff_e);
+		part->spins = 0;
+		part->delay = 0;
+	}
+
+	tst_init_stat(&group->spins_avg);
+	group->sampling = group->min_samples;
+	group->cached = 0;
+	group->cache_site = tst_fzsync_cache_site();
+
+	if (!tst_fzsync_cache_load(group->cache_site, group->participants, vals,
+				   TST_FZSYNC_CACHE_NVALS(group->participants))) {
+		tst_fzsync_cache_copy(group, vals, 1);
+		group->sampling = MIN(TST_FZSYNC_VALIDATE_SAMPLES,
+				      group->min_samples);
+		group->cached = 1;
+
+		for (i = 0; i < group->participants; i++) {
+			part = &group->part[i];
+			part->cached_se = part->diff_se;
+			part->cached_e = part->diff_e;
+		}
+	}
+
+	group->exec_loop = 0;
 
-	tst_init_stat(&pair->diff_ss);
-	tst_init_stat(&pair->diff_sa);
-	tst_init_stat(&pair->diff_sb);
-	tst_init_stat(&pair->diff_ab);
-	tst_init_stat(&pair->spins_avg);
-	pair->delay = 0;
-	pair->sampling = pair->min_samples;
+	group->cntr = 0;
+	group->gen = 0;
+	group->exit = 0;
 
-	pair->exec_loop = 0;
+	tst_fzsync_place_reset(group);
 
-	pair->a_cntr = 0;
-	pair->b_cntr = 0;
-	pair->exit = 0;
-	if (run_b)
-		SAFE_PTHREAD_CREATE(&pair->thread_b, 0, run_b, 0);
+	for (i = 1; run && i < group->participants; i++) {
+		if (!group->processes) {
+			SAFE_PTHREAD_CREATE(&group->threads[i], 0, run,
+					    (void *)i);
+			continue;
+		}
 
-	pair->exec_time_start = (float)tst_timeout_remaining();
+		group->pids[i] = SAFE_FORK();
+		if (!group->pids[i]) {
+			run((void *)i);
+			exit(0);
+		}
+	}
+
+	group->exec_time_start = (float)tst_timeout_remaining();
 }
 
 /**
@@ -293,22 +666,50 @@ static inline void tst_fzsync_stat_info(struct tst_fzsync_stat stat,
 /**
  * Print some synchronisation statistics
  *
- * @relates tst_fzsync_pair
+ * @relates tst_fzsync_group
  */
-static void tst_fzsync_pair_info(struct tst_fzsync_pair *pair)
+static void tst_fzsync_group_info(struct tst_fzsync_group *group)
 {
-	tst_res(TINFO, "loop = %d, delay_bias = %d",
-		pair->exec_loop, pair->delay_bias);
-	tst_fzsync_stat_info(pair->diff_ss, "ns", "start_a - start_b");
-	tst_fzsync_stat_info(pair->diff_sa, "ns", "end_a - start_a");
-	tst_fzsync_stat_info(pair->diff_sb, "ns", "end_b - start_b");
-	tst_fzsync_stat_info(pair->diff_ab, "ns", "end_a - end_b");
-	tst_fzsync_stat_info(pair->spins_avg, "  ", "spins");
+	struct tst_fzsync_participant *part;
+	char name[32];
+	int i;
+
+	tst_res(TINFO, "loop = %d, participants = %d",
+		group->exec_loop, group->participants);
+
+	for (i = 0; i < group->participants; i++) {
+		part = &group->part[i];
+
+		if (i) {
+			snprintf(name, sizeof(name), "start_0 - start_%d", i);
+			tst_fzsync_stat_info(part->diff_s, "ns", name);
+		}
+
+		snprintf(name, sizeof(name), "end_%d - start_%d", i, i);
+		tst_fzsync_stat_info(part->diff_se, "ns", name);
+
+		if (i) {
+			snprintf(name, sizeof(name), "end_0 - end_%d", i);
+			tst_fzsync_stat_info(part->diff_e, "ns", name);
+			tst_res(TINFO, "delay_bias_%d = %d", i,
+				part->delay_bias - group->part[0].delay_bias);
+		}
+	}
+
+	tst_fzsync_stat_info(group->spins_avg, "  ", "spins");
+
+	if (group->placement)
+		tst_fzsync_place_info(group);
 }
 
-/** Wraps clock_gettime */
+/** Wraps clock_gettime or reads the cycle counter, see tst_tsc.h */
 static inline void tst_fzsync_time(struct timespec *t)
 {
+	if (tst_tsc.enabled) {
+		tst_tsc_gettime(t);
+		return;
+	}
+
 #ifdef CLOCK_MONOTONIC_RAW
 	clock_gettime(CLOCK_MONOTONIC_RAW, t);
 #else
@@ -360,6 +761,164 @@ static inline void tst_upd_diff_stat(struct tst_fzsync_stat *s,
 	tst_upd_stat(s, alpha, tst_timespec_diff_ns(t1, t2));
 }
 
+static int tst_fzsync_over_max_dev(struct tst_fzsync_group *group)
+{
+	struct tst_fzsync_participant *part;
+	float max_dev = group->max_dev_ratio;
+	int i;
+
+	if (group->spins_avg.dev_ratio > max_dev)
+		return 1;
+
+	for (i = 0; i < group->participants; i++) {
+		part = &group->part[i];
+
+		if (part->diff_s.dev_ratio > max_dev
+		    || part->diff_se.dev_ratio > max_dev
+		    || part->diff_e.dev_ratio > max_dev)
+			return 1;
+	}
+
+	return 0;
+}
+
+static void tst_fzsync_group_sample(struct tst_fzsync_group *group)
+{
+	struct tst_fzsync_participant *part, *part0 = &group->part[0];
+	float alpha = group->avg_alpha;
+	int i, spins = 0;
+
+	for (i = 0; i < group->participants; i++) {
+		part = &group->part[i];
+
+		if (i) {
+			tst_upd_diff_stat(&part->diff_s, alpha,
+					  part0->start, part->start);
+			tst_upd_diff_stat(&part->diff_e, alpha,
+					  part0->end, part->end);
+		}
+
+		tst_upd_diff_stat(&part->diff_se, alpha,
+				  part->end, part->start);
+		spins += part->spins;
+	}
+
+	tst_upd_stat(&group->spins_avg, alpha, spins);
+
+	/* Resampling after the validation period, store the new statistics */
+	if (group->sampling <= 0)
+		group->cached = 0;
+}
+
+/*
+ * Shifts the delays so that none of them is negative, i.e. a negative delay
+ * of participant i delays participant 0 and the rest instead.
+ */
+static void tst_fzsync_group_shift(struct tst_fzsync_group *group)
+{
+	int i, min_delay = 0;
+
+	for (i = 1; i < group->participants; i++) {
+		min_delay = MIN(min_delay,
+				group->part[i].delay - group->part[0].delay);
+	}
+
+	for (i = 0; i < group->participants; i++)
+		group->part[i].delay -= min_delay;
+}
+
+/*
+ * Picks random delays for all participants, returns the estimated time of a
+ * single spin or zero if the delays could not be calculated, in which case
+ * only the biases are applied.
+ */
+static float tst_fzsync_group_delays(struct tst_fzsync_group *group)
+{
+	struct tst_fzsync_participant *part, *part0 = &group->part[0];
+	float per_spin_time, time_delay, end_diffs = 0;
+	int i;
+
+	for (i = 1; i < group->participants; i++)
+		end_diffs += fabsf(group->part[i].diff_e.avg);
+
+	if (end_diffs < 1 || group->spins_avg.avg < 1) {
+		tst_fzsync_group_shift(group);
+		return 0;
+	}
+
+	per_spin_time = end_diffs / group->spins_avg.avg;
+
+	for (i = 1; i < group->participants; i++) {
+		part = &group->part[i];
+
+		time_delay = drand48() * (part0->diff_se.avg + part->diff_se.avg)
+			- part->diff_se.avg;
+		part->delay += (int)(time_delay / per_spin_time);
+	}
+
+	tst_fzsync_group_shift(group);
+
+	return per_spin_time;
+}
+
+static void tst_fzsync_group_ranges(struct tst_fzsync_group *group,
+				    float per_spin_time)
+{
+	struct tst_fzsync_participant *part, *part0 = &group->part[0];
+	int i, bias;
+
+	for (i = 1; i < group->participants; i++) {
+		part = &group->part[i];
+		bias = part->delay_bias - part0->delay_bias;
+
+		tst_res(TINFO, "Delay range of %d is [-%d, %d]", i,
+			(int)(part->diff_se.avg / per_spin_time) + bias,
+			(int)(part0->diff_se.avg / per_spin_time) - bias);
+	}
+}
+
+static int tst_fzsync_stat_agrees(const struct tst_fzsync_stat *fresh,
+				  const struct tst_fzsync_stat *cached,
+				  float max_dev)
+{
+	float tolerance = 3 * cached->avg_dev + max_dev * fabsf(cached->avg);
+
+	return fabsf(fresh->avg - cached->avg) <= tolerance;
+}
+
+/*
+ * Compares the statistics sampled in the validation period with the cached
+ * ones, if the race timing has changed the cache entry is dropped and the
+ * full sampling period is done instead.
+ */
+static void tst_fzsync_cache_check(struct tst_fzsync_group *group)
+{
+	struct tst_fzsync_participant *part;
+	int i;
+
+	for (i = 0; i < group->participants; i++) {
+		part = &group->part[i];
+
+		if (!tst_fzsync_stat_agrees(&part->diff_se, &part->cached_se,
+					    group->max_dev_ratio)
+		    || (i && !tst_fzsync_stat_agrees(&part->diff_e,
+						     &part->cached_e,
+						     group->max_dev_ratio)))
+			break;
+	}
+
+	if (i >= group->participants) {
+		tst_res(TINFO, "Cached fzsync calibration confirmed");
+		return;
+	}
+
+	tst_res(TINFO, "Cached fzsync calibration of %d differs, resampling",
+		i);
+	group->cached = 0;
+	group->sampling = MAX(group->min_samples - TST_FZSYNC_VALIDATE_SAMPLES,
+			      1);
+}
+
 /**
  * Calculate various statistics and the delay
  *
@@ -446,270 +1005,305 @@ static inline void tst_upd_diff_stat(struct tst_fzsync_stat *s,
  * may fail to introduce a delay (when one is needed) in situations where
  * Syscall A and B finish at approximately the same time.
  *
- * @relates tst_fzsync_pair
+ * With more than two participants each one is paired with thread 0 (A) and
+ * its delay is picked from its own range as above. The delays are then
+ * shifted so that none of them is negative, i.e. the thread that should
+ * start first does not spin at all. The time per spin is estimated from the
+ * sum of end time differences to thread 0 divided by the total number of
+ * spins done in end_race, which is exact for two participants and an
+ * approximation otherwise.
+ *
+ * @relates tst_fzsync_group
  */
-static void tst_fzsync_pair_update(struct tst_fzsync_pair *pair)
-{
-	float alpha = pair->avg_alpha;
-	float per_spin_time, time_delay;
-	float max_dev = pair->max_dev_ratio;
-	int over_max_dev;
-
-	pair->delay = pair->delay_bias;
-
-	over_max_dev = pair->diff_ss.dev_ratio > max_dev
-		|| pair->diff_sa.dev_ratio > max_dev
-		|| pair->diff_sb.dev_ratio > max_dev
-		|| pair->diff_ab.dev_ratio > max_dev
-		|| pair->spins_avg.dev_ratio > max_dev;
-
-	if (pair->sampling > 0 || over_max_dev) {
-		tst_upd_diff_stat(&pair->diff_ss, alpha,
-				  pair->a_start, pair->b_start);
-		tst_upd_diff_stat(&pair->diff_sa, alpha,
-				  pair->a_end, pair->a_start);
-		tst_upd_diff_stat(&pair->diff_sb, alpha,
-				  pair->b_end, pair->b_start);
-		tst_upd_diff_stat(&pair->diff_ab, alpha,
-				  pair->a_end, pair->b_end);
-		tst_upd_stat(&pair->spins_avg, alpha, pair->spins);
-		if (pair->sampling > 0 && --pair->sampling == 0) {
-			tst_res(TINFO, "Minimum sampling period ended");
-			tst_fzsync_pair_info(pair);
-		}
-	} else if (fabsf(pair->diff_ab.avg) >= 1 && pair->spins_avg.avg >= 1) {
-		per_spin_time = fabsf(pair->diff_ab.avg) / pair->spins_avg.avg;
-		time_delay = drand48() * (pair->diff_sa.avg + pair->diff_sb.avg)
-			- pair->diff_sb.avg;
-		pair->delay += (int)(time_delay / per_spin_time);
+static void tst_fzsync_group_update(struct tst_fzsync_group *group)
+{
+	float per_spin_time;
+	int i;
+
+	for (i = 0; i < group->participants; i++)
+		group->part[i].delay = group->part[i].delay_bias;
+
+	if (group->sampling > 0 || tst_fzsync_over_max_dev(group)) {
+		tst_fzsync_group_shift(group);
+		tst_fzsync_group_sample(group);
 
-		if (!pair->sampling) {
+		if (group->sampling > 0 && --group->sampling == 0) {
+			if (group->cached) {
+				tst_fzsync_cache_check(group);
+			} else {
+				tst_res(TINFO, "Minimum sampling period ended");
+				tst_fzsync_group_info(group);
+			}
+		}
+	} else if ((per_spin_time = tst_fzsync_group_delays(group))) {
+		if (!group->sampling) {
 			tst_res(TINFO,
 				"Reached deviation ratios < %.2f, introducing randomness",
-				pair->max_dev_ratio);
-			tst_res(TINFO, "Delay range is [-%d, %d]",
-				(int)(pair->diff_sb.avg / per_spin_time) + pair->delay_bias,
-				(int)(pair->diff_sa.avg / per_spin_time) - pair->delay_bias);
-			tst_fzsync_pair_info(pair);
-			pair->sampling = -1;
+				group->max_dev_ratio);
+			tst_fzsync_group_ranges(group, per_spin_time);
+			tst_fzsync_group_info(group);
+			group->sampling = -1;
+
+			if (!group->cached)
+				tst_fzsync_cache_save(group);
 		}
-	} else if (!pair->sampling) {
+	} else if (!group->sampling) {
 		tst_res(TWARN, "Can't calculate random delay");
-		pair->sampling = -1;
+		group->sampling = -1;
 	}
 
-	pair->spins = 0;
+	for (i = 0; i < group->participants; i++)
+		group->part[i].spins = 0;
 }
 
 /**
- * Wait for the other thread
+ * Wait for the other participants
  *
- * @relates tst_fzsync_pair
- * @param our_cntr The counter for the thread we are on
- * @param other_cntr The counter for the thread we are synchronising with
+ * @relates tst_fzsync_group
  * @param spins A pointer to the spin counter or NULL
  *
- * Used by tst_fzsync_pair_wait_a(), tst_fzsync_pair_wait_b(),
- * tst_fzsync_start_race_a(), etc. If the calling thread is ahead of the other
- * thread, then it will spin wait. Unlike pthread_barrier_wait it will never
- * use futex and can count the number of spins spent waiting.
- *
- * @return A non-zero value if the thread should continue otherwise the
- * calling thread should exit.
+ * Used by tst_fzsync_group_start_race(), tst_fzsync_group_end_race(), etc.
+ * If the calling participant is ahead of the others, then it will spin wait
+ * until all of them arrive. Unlike pthread_barrier_wait it will never use
+ * futex and can count the number of spins spent waiting. If there are more
+ * participants than CPUs the waiting ones yield the CPU, otherwise the one
+ * everybody waits for may not get scheduled until the time slice runs out.
  */
-static inline void tst_fzsync_pair_wait(int *our_cntr,
-					int *other_cntr,
-					int *spins)
-{
-	if (tst_atomic_inc(other_cntr) == INT_MAX) {
-		/*
-		 * We are about to break the invariant that the thread with
-		 * the lowest count is in front of the other. So we must wait
-		 * here to ensure the other thread has at least reached the
-		 * line above before doing that. If we are in rear position
-		 * then our counter may already have been set to zero.
-		 */
-		while (tst_atomic_load(our_cntr) > 0
-		       && tst_atomic_load(our_cntr) < INT_MAX) {
-			if (spins)
-				(*spins)++;
-		}
+static inline void tst_fzsync_barrier(struct tst_fzsync_group *group,
+				      int *spins)
+{
+	int gen = tst_atomic_load(&group->gen);
 
-		tst_atomic_store(0, other_cntr);
-		/*
-		 * Once both counters have been set to zero the invariant
-		 * is restored and we can continue.
-		 */
-		while (tst_atomic_load(our_cntr) > 1)
-			;
-	} else {
-		/*
-		 * If our counter is less than the other thread's we are ahead
-		 * of it and need to wait.
-		 */
-		while (tst_atomic_load(our_cntr) < tst_atomic_load(other_cntr)) {
-			if (spins)
-				(*spins)++;
-		}
+	if (tst_atomic_inc(&group->cntr) == group->participants) {
+		/* Reset the counter before anyone can pass the barrier */
+		tst_atomic_store(0, &group->cntr);
+		tst_atomic_store(gen + 1, &group->gen);
+		return;
 	}
-}
 
-/**
- * Wait in thread A
- *
- * @relates tst_fzsync_pair
- * @sa tst_fzsync_pair_wait
- */
-static inline void tst_fzsync_wait_a(struct tst_fzsync_pair *pair)
-{
-	tst_fzsync_pair_wait(&pair->a_cntr, &pair->b_cntr, NULL);
+	while (tst_atomic_load(&group->gen) == gen) {
+		if (spins)
+			(*spins)++;
+		if (group->yield)
+			sched_yield();
+	}
 }
 
 /**
- * Wait in thread B
+ * Wait in participant i
  *
- * @relates tst_fzsync_pair
- * @sa tst_fzsync_pair_wait
+ * @relates tst_fzsync_group
+ * @sa tst_fzsync_barrier
  */
-static inline void tst_fzsync_wait_b(struct tst_fzsync_pair *pair)
+static inline void tst_fzsync_group_wait(struct tst_fzsync_group *group,
+					 int i LTP_ATTRIBUTE_UNUSED)
 {
-	tst_fzsync_pair_wait(&pair->b_cntr, &pair->a_cntr, NULL);
+	tst_fzsync_barrier(group, NULL);
 }
 
 /**
- * Decide whether to continue running thread A
+ * Decide whether to continue running participant i
  *
- * @relates tst_fzsync_pair
+ * @relates tst_fzsync_group
  *
- * Checks some values and decides whether it is time to break the loop of
- * thread A.
+ * Participant 0 checks some values and decides whether it is time to break
+ * the loops, the other participants follow the decision.
  *
  * @return True to continue and false to break.
- * @sa tst_fzsync_run_a
  */
-static inline int tst_fzsync_run_a(struct tst_fzsync_pair *pair)
+static inline int tst_fzsync_group_run(struct tst_fzsync_group *group, int i)
 {
 	int exit = 0;
-	float rem_p = 1 - tst_timeout_remaining() / pair->exec_time_start;
+	float rem_p;
 
-	if ((pair->exec_time_p * SAMPLING_SLICE < rem_p)
-		&& (pair->sampling > 0)) {
+	if (i) {
+		tst_fzsync_barrier(group, NULL);
+		exit = tst_atomic_load(&group->exit);
+		tst_fzsync_place_self(group, i,
+			exit ? TST_FZSYNC_PLACE_NONE : group->place_cur);
+		return !exit;
+	}
+
+	if (group->placement && group->exec_loop)
+		tst_fzsync_place_update(group);
+
+	rem_p = 1 - tst_timeout_remaining() / group->exec_time_start;
+
+	if ((group->exec_time_p * SAMPLING_SLICE < rem_p)
+		&& (group->sampling > 0)) {
 		tst_res(TINFO, "Stopped sampling at %d (out of %d) samples, "
 			"sampling time reached 50%% of the total time limit",
-			pair->exec_loop, pair->min_samples);
-		pair->sampling = 0;
-		tst_fzsync_pair_info(pair);
+			group->exec_loop, group->min_samples);
+		group->sampling = 0;
+		tst_fzsync_group_info(group);
 	}
 
-	if (pair->exec_time_p < rem_p) {
+	if (group->exec_time_p < rem_p) {
 		tst_res(TINFO,
 			"Exceeded execution time, requesting exit");
 		exit = 1;
 	}
 
-	if (++pair->exec_loop > pair->exec_loops) {
+	if (++group->exec_loop > group->exec_loops) {
 		tst_res(TINFO,
 			"Exceeded execution loops, requesting exit");
 		exit = 1;
 	}
 
-	tst_atomic_store(exit, &pair->exit);
-	tst_fzsync_wait_a(pair);
+	tst_atomic_store(exit, &group->exit);
+	tst_fzsync_barrier(group, NULL);
 
 	if (exit) {
-		tst_fzsync_pair_cleanup(pair);
+		tst_fzsync_place_self(group, 0, TST_FZSYNC_PLACE_NONE);
+		if (group->placement)
+			tst_fzsync_place_info(group);
+		tst_fzsync_group_cleanup(group);
 		return 0;
 	}
 
-	return 1;
-}
+	tst_fzsync_place_self(group, 0, group->place_cur);
 
-/**
- * Decide whether to continue running thread B
- *
- * @relates tst_fzsync_pair
- * @sa tst_fzsync_run_a
- */
-static inline int tst_fzsync_run_b(struct tst_fzsync_pair *pair)
-{
-	tst_fzsync_wait_b(pair);
-	return !tst_atomic_load(&pair->exit);
+	return 1;
 }
 
 /**
- * Marks the start of a race region in thread A
+ * Marks the start of a race region in participant i
  *
- * @relates tst_fzsync_pair
+ * @relates tst_fzsync_group
  *
  * This should be placed just before performing whatever action can cause a
  * race condition. Usually it is placed just before a syscall and
- * tst_fzsync_end_race_a() is placed just afterwards.
- *
- * A corresponding call to tst_fzsync_start_race_b() should be made in thread
- * B.
+ * tst_fzsync_group_end_race() is placed just afterwards.
  *
- * @return A non-zero value if the calling thread should continue to loop. If
- * it returns zero then tst_fzsync_exit() has been called and you must exit
- * the thread.
- *
- * @sa tst_fzsync_pair_update
+ * @sa tst_fzsync_group_update
  */
-static inline void tst_fzsync_start_race_a(struct tst_fzsync_pair *pair)
+static inline void tst_fzsync_group_start_race(struct tst_fzsync_group *group,
+					       int i)
 {
 	volatile int delay;
 
-	tst_fzsync_pair_update(pair);
+	if (!i)
+		tst_fzsync_group_update(group);
 
-	tst_fzsync_wait_a(pair);
+	tst_fzsync_barrier(group, NULL);
 
-	delay = pair->delay;
-	while (delay < 0)
-		delay++;
+	delay = group->part[i].delay;
+	while (delay > 0)
+		delay--;
 
-	tst_fzsync_time(&pair->a_start);
+	tst_fzsync_time(&group->part[i].start);
 }
 
 /**
- * Marks the end of a race region in thread A
+ * Marks the end of a race region in participant i
  *
- * @relates tst_fzsync_pair
- * @sa tst_fzsync_start_race_a
+ * @relates tst_fzsync_group
+ * @sa tst_fzsync_group_start_race
  */
-static inline void tst_fzsync_end_race_a(struct tst_fzsync_pair *pair)
+static inline void tst_fzsync_group_end_race(struct tst_fzsync_group *group,
+					     int i)
 {
-	tst_fzsync_time(&pair->a_end);
-	tst_fzsync_pair_wait(&pair->a_cntr, &pair->b_cntr, &pair->spins);
+	tst_fzsync_time(&group->part[i].end);
+	tst_fzsync_barrier(group, &group->part[i].spins);
 }
 
 /**
- * Marks the start of a race region in thread B
+ * Add some amount to the delay bias of participant i
  *
- * @relates tst_fzsync_pair
- * @sa tst_fzsync_start_race_a
+ * @relates tst_fzsync_group
+ * @param change The amount to add, can be negative
+ *
+ * A positive change delays participant i relative to participant 0 and a
+ * negative one delays participant 0. See tst_fzsync_pair_add_bias().
  */
-static inline void tst_fzsync_start_race_b(struct tst_fzsync_pair *pair)
+static inline void tst_fzsync_group_add_bias(struct tst_fzsync_group *group,
+					     int i, int change)
 {
-	volatile int delay;
+	if (group->sampling > 0)
+		group->part[i].delay_bias += change;
+}
 
-	tst_fzsync_wait_b(pair);
+/*
+ * Two way race API, thread A is participant 0 and thread B participant 1.
+ */
 
-	delay = pair->delay;
-	while (delay > 0)
-		delay--;
+/** The state of a two way synchronisation or race. */
+#define tst_fzsync_pair tst_fzsync_group
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_init */
+static inline void tst_fzsync_pair_init(struct tst_fzsync_pair *pair)
+{
+	if (pair->participants > 2)
+		tst_brk(TBROK, "fzsync pair has more than two participants");
 
-	tst_fzsync_time(&pair->b_start);
+	tst_fzsync_group_init(pair);
 }
 
-/**
- * Marks the end of a race region in thread B
- *
- * @relates tst_fzsync_pair
- * @sa tst_fzsync_start_race_a
- */
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_cleanup */
+static inline void tst_fzsync_pair_cleanup(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_cleanup(pair);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_reset */
+static inline void tst_fzsync_pair_reset(struct tst_fzsync_pair *pair,
+					 void *(*run_b)(void *))
+{
+	tst_fzsync_group_reset(pair, run_b);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_info */
+static inline void tst_fzsync_pair_info(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_info(pair);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_wait */
+static inline void tst_fzsync_wait_a(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_wait(pair, 0);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_wait */
+static inline void tst_fzsync_wait_b(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_wait(pair, 1);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_run */
+static inline int tst_fzsync_run_a(struct tst_fzsync_pair *pair)
+{
+	return tst_fzsync_group_run(pair, 0);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_run */
+static inline int tst_fzsync_run_b(struct tst_fzsync_pair *pair)
+{
+	return tst_fzsync_group_run(pair, 1);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_start_race */
+static inline void tst_fzsync_start_race_a(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_start_race(pair, 0);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_end_race */
+static inline void tst_fzsync_end_race_a(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_end_race(pair, 0);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_start_race */
+static inline void tst_fzsync_start_race_b(struct tst_fzsync_pair *pair)
+{
+	tst_fzsync_group_start_race(pair, 1);
+}
+
+/** @relates tst_fzsync_pair @sa tst_fzsync_group_end_race */
 static inline void tst_fzsync_end_race_b(struct tst_fzsync_pair *pair)
 {
-	tst_fzsync_time(&pair->b_end);
-	tst_fzsync_pair_wait(&pair->b_cntr, &pair->a_cntr, &pair->spins);
+	tst_fzsync_group_end_race(pair, 1);
 }
 
 /**
@@ -738,8 +1332,7 @@ static inline void tst_fzsync_end_race_b(struct tst_fzsync_pair *pair)
  */
 static inline void tst_fzsync_pair_add_bias(struct tst_fzsync_pair *pair, int change)
 {
-	if (pair->sampling > 0)
-		pair->delay_bias += change;
+	tst_fzsync_group_add_bias(pair, 1, change);
 }
 
 #endif /* TST_FUZZY_SYNC_H__ */
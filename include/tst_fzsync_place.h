@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * CPU placement of fuzzy sync participants, see tst_fuzzy_sync.h.
+ */
+
+#ifndef TST_FZSYNC_PLACE_H__
+#define TST_FZSYNC_PLACE_H__
+
+/* Must match TST_FZSYNC_MAX_PARTICIPANTS */
+#define TST_FZSYNC_PLACE_MAX 8
+
+enum tst_fzsync_placement {
+	/* No pinning, the scheduler decides */
+	TST_FZSYNC_PLACE_NONE,
+	/* SMT siblings of a single core */
+	TST_FZSYNC_PLACE_SMT,
+	/* Different cores sharing the last level cache */
+	TST_FZSYNC_PLACE_LLC,
+	/* Different packages */
+	TST_FZSYNC_PLACE_CROSS,
+	/* Cycle through the possible placements each iteration */
+	TST_FZSYNC_PLACE_ROTATE,
+};
+
+/* Number of placements other than rotate */
+#define TST_FZSYNC_PLACEMENTS TST_FZSYNC_PLACE_ROTATE
+
+/*
+ * Reads the CPU topology and picks CPUs for each placement, only CPUs in the
+ * affinity mask of the caller are considered. Returns a bitmask of the
+ * placements possible for the number of participants on this machine.
+ */
+int tst_fzsync_place_init(int participants);
+
+/*
+ * Pins the calling thread to the CPU of participant i for the placement,
+ * TST_FZSYNC_PLACE_NONE restores the original affinity.
+ */
+void tst_fzsync_place(int placement, int i);
+
+/* Returns the CPU of participant i for the placement or -1 */
+int tst_fzsync_place_cpu(int placement, int i);
+
+/* Returns the placement set by LTP_FZSYNC_PLACEMENT or none */
+int tst_fzsync_place_env(void);
+
+const char *tst_fzsync_place_name(int placement);
+
+#endif /* TST_FZSYNC_PLACE_H__ */
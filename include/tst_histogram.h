@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Fixed size log-linear histogram.
+ *
+ * Values below 2^TST_HISTOGRAM_SUB_BITS are counted exactly, larger values
+ * fall into one of 2^TST_HISTOGRAM_SUB_BITS equally sized buckets of their
+ * power of two range, i.e. the relative error of a value read back from the
+ * histogram is less than 2^-TST_HISTOGRAM_SUB_BITS. Recording is O(1) and two
+ * histograms can be merged, so each thread can record into its own one.
+ *
+ * struct tst_histogram *h = tst_histogram_alloc();
+ *
+ * for (...)
+ *	tst_histogram_record(h, sample);
+ *
+ * median = tst_histogram_percentile(h, 50);
+ */
+
+#ifndef TST_HISTOGRAM_H__
+#define TST_HISTOGRAM_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define TST_HISTOGRAM_SUB_BITS 7
+/* Values are clamped to 2^TST_HISTOGRAM_MAX_BITS - 1 */
+#define TST_HISTOGRAM_MAX_BITS 48
+#define TST_HISTOGRAM_BUCKETS \
+	((TST_HISTOGRAM_MAX_BITS - TST_HISTOGRAM_SUB_BITS + 1) \
+	 << TST_HISTOGRAM_SUB_BITS)
+
+struct tst_histogram {
+	uint64_t count;
+	long long min;
+	long long max;
+	long long sum;
+	uint64_t buckets[TST_HISTOGRAM_BUCKETS];
+};
+
+struct tst_histogram *tst_histogram_alloc(void);
+void tst_histogram_free(struct tst_histogram *h);
+void tst_histogram_reset(struct tst_histogram *h);
+
+static inline unsigned int tst_histogram_index(long long val)
+{
+	unsigned int msb;
+
+	if (val < (1LL << TST_HISTOGRAM_SUB_BITS))
+		return val < 0 ? 0 : val;
+
+	if (val >= (1LL << TST_HISTOGRAM_MAX_BITS))
+		return TST_HISTOGRAM_BUCKETS - 1;
+
+	msb = 63 - __builtin_clzll(val);
+
+	return ((msb - TST_HISTOGRAM_SUB_BITS + 1) << TST_HISTOGRAM_SUB_BITS)
+		+ (val >> (msb - TST_HISTOGRAM_SUB_BITS))
+		- (1 << TST_HISTOGRAM_SUB_BITS);
+}
+
+static inline void tst_histogram_record(struct tst_histogram *h, long long val)
+{
+	if (!h->count || val < h->min)
+		h->min = val;
+
+	if (!h->count || val > h->max)
+		h->max = val;
+
+	h->count++;
+	h->sum += val;
+	h->buckets[tst_histogram_index(val)]++;
+}
+
+/* Adds all values recorded in src to dst */
+void tst_histogram_merge(struct tst_histogram *dst,
+			 const struct tst_histogram *src);
+
+/* The smallest value and the width of the bucket */
+long long tst_histogram_bucket_low(unsigned int idx);
+long long tst_histogram_bucket_width(unsigned int idx);
+
+/*
+ * Returns a value representative for the bucket, i.e. the middle of it
+ * clamped to the minimal and maximal recorded value.
+ */
+long long tst_histogram_bucket_value(const struct tst_histogram *h,
+				     unsigned int idx);
+
+/*
+ * Returns the value below which lie at least percent of the samples, zero
+ * for an empty histogram.
+ */
+long long tst_histogram_percentile(const struct tst_histogram *h,
+				   double percent);
+
+/* Sum of the n largest values */
+long long tst_histogram_sum_top(const struct tst_histogram *h, uint64_t n);
+
+/*
+ * Writes the non-empty buckets into a text file, read back with
+ * tst_histogram_read() which returns non-zero if the file is not a
+ * histogram with the same bucket layout.
+ */
+void tst_histogram_write(const struct tst_histogram *h, FILE *f);
+int tst_histogram_read(struct tst_histogram *h, FILE *f);
+
+#endif /* TST_HISTOGRAM_H__ */
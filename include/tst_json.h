@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Structured output, if LTP_JSON_OUTPUT is set the test library appends one
+ * JSON object per line to that file for each result and each test phase.
+ *
+ * Each object has "ts" (CLOCK_MONOTONIC in ns), "pid" and "type" keys, the
+ * rest depends on the type. The "rusage" record is added after each test run
+ * with user and system time, max RSS, page faults and context switches of the
+ * test process and the children it waited for.
+ *
+ * The records are formatted into a per-process buffer and written with a
+ * single write(2) to a file opened with O_APPEND once the buffer is full, at
+ * the end of each phase and at exit, the buffer is reset in children after
+ * fork() so that records are never written twice. Records added while the
+ * buffer is in use, i.e. from another thread or a signal handler, are written
+ * out directly.
+ */
+
+#ifndef TST_JSON_H__
+#define TST_JSON_H__
+
+/*
+ * Opens the output file if LTP_JSON_OUTPUT is set.
+ */
+void tst_json_init(void);
+
+int tst_json_enabled(void);
+
+/*
+ * Current CLOCK_MONOTONIC timestamp in ns.
+ */
+unsigned long long tst_json_ts(void);
+
+/*
+ * Adds a record of a type, fmt should expand into comma separated list of
+ * JSON key value pairs.
+ */
+void tst_json_event(const char *type, const char *fmt, ...)
+	__attribute__ ((format (printf, 2, 3)));
+
+void tst_json_res(const char *file, int lineno, const char *res,
+		  const char *msg);
+
+/*
+ * Adds phase record, the end of the phase is now.
+ *
+ * @phase: setup, test or cleanup
+ * @tcase: test number for the test phase, -1 otherwise
+ * @start: tst_json_ts() at the start of the phase
+ */
+void tst_json_phase(const char *phase, int tcase, unsigned long long start);
+
+void tst_json_flush(void);
+
+#endif /* TST_JSON_H__ */
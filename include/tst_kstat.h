@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Snapshots of system wide kernel counters from /proc/vmstat,
+ * /proc/schedstat, /proc/pressure/ and /proc/interrupts, used by the test
+ * library to report which counters were changed by a test run when LTP_KSTAT
+ * is set.
+ */
+
+#ifndef TST_KSTAT_H__
+#define TST_KSTAT_H__
+
+/*
+ * Returns number of changed counters to report or 0 if disabled.
+ */
+unsigned int tst_kstat_enabled(void);
+
+/*
+ * Reads the files into preallocated buffers, the parsing is postponed until
+ * tst_kstat_report() so that taking a snapshot is cheap.
+ *
+ * @after: 0 for snapshot before the test run, 1 for after
+ */
+void tst_kstat_snapshot(int after);
+
+/*
+ * Parses both snapshots and prints counters that changed sorted by delta.
+ */
+void tst_kstat_report(void);
+
+#endif /* TST_KSTAT_H__ */
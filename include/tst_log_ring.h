@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Shared memory log ring, enabled by LTP_LOG_RING.
+ *
+ * The library process that forks the test creates the ring, the test process
+ * and all its forked children append the formatted messages into fixed size
+ * slots without any syscall and the library process prints them in the order
+ * the slots were reserved. Messages that has been stored survive the child
+ * being killed.
+ *
+ * The ring is a bounded multi-producer single-consumer queue, each slot has a
+ * sequence number that tells if it's free for the producer (seq == pos) or
+ * filled for the consumer (seq == pos + 1). If the ring is full or the
+ * message does not fit the slot it's printed directly to stderr.
+ */
+
+#ifndef TST_LOG_RING_H__
+#define TST_LOG_RING_H__
+
+/*
+ * Maps the ring if LTP_LOG_RING is set, returns non-zero if ring is in use.
+ */
+int tst_log_ring_init(void);
+
+/*
+ * Called in the test process after fork(), messages from this process and
+ * its children are appended to the ring from now on.
+ */
+void tst_log_ring_producer(void);
+
+/*
+ * Returns non-zero if the message has been stored in the ring.
+ */
+int tst_log_ring_put(const char *msg);
+
+/*
+ * Prints the filled slots to stderr, no-op in producers.
+ *
+ * @final: the producers are gone, slots that were reserved but never filled
+ *         are skipped and reported.
+ */
+void tst_log_ring_drain(int final);
+
+#endif /* TST_LOG_RING_H__ */
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Per-test perf_event counters, used by the test library to account what the
+ * test process tree costs when LTP_PERF_COUNTERS or LTP_PERF_OUTPUT is set.
+ */
+
+#ifndef TST_PERF_H__
+#define TST_PERF_H__
+
+#include <sys/types.h>
+
+/*
+ * Returns non-zero if counters were requested in the environment.
+ */
+int tst_perf_enabled(void);
+
+/*
+ * Opens counters inherited by children for the process, hardware counters
+ * that are not available, e.g. in VMs without PMU, are skipped. Only user
+ * space is counted if perf_event_paranoid does not allow kernel profiling.
+ *
+ * Returns number of counters opened.
+ */
+int tst_perf_open(pid_t pid);
+
+/*
+ * Reads, prints and closes the counters opened by tst_perf_open(), should be
+ * called once the process has been reaped so that the values include all
+ * children.
+ */
+void tst_perf_report(const char *tid);
+
+#endif /* TST_PERF_H__ */
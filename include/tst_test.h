@@ -125,6 +125,12 @@ struct tst_test {
 	/* If set the test is compiled out */
 	const char *tconf_msg;
 
+	/*
+	 * Number of checkpoint ids the test needs if more than fits into a
+	 * single page, implies needs_checkpoints.
+	 */
+	unsigned int max_checkpoints;
+
 	int needs_tmpdir:1;
 	int needs_root:1;
 	int forks_child:1;
@@ -175,6 +181,22 @@ struct tst_test {
 	/* Sampling function for timer measurement testcases */
 	int (*sample)(int clk_id, long long usec);
 
+	/* Benchmark function, see tst_bench.h */
+	void (*bench)(void);
+
+	/* Benchmark parameters, default is used if not set */
+	unsigned int bench_warmup;
+	unsigned int bench_iterations;
+	unsigned int bench_time_ms;
+
+	/*
+	 * Limits for the test cgroup, used only if LTP_CGROUP is set, see
+	 * tst_cgroup.h. Memory is in bytes, CPU in percent of one CPU.
+	 */
+	unsigned long long cgroup_memory_max;
+	unsigned int cgroup_pids_max;
+	unsigned int cgroup_cpu_max;
+
 	/* NULL terminated array of resource file names */
 	const char *const *resource_files;
 
@@ -236,6 +258,13 @@ const char *tst_strstatus(int status);
 unsigned int tst_timeout_remaining(void);
 void tst_set_timeout(int timeout);
 
+/*
+ * Returns the index of the test function being run, i.e. the argument of
+ * tst_test->test() or 0 for tst_test->test_all(). If calls is not NULL it's
+ * set to the number of test function calls so far in this process.
+ */
+unsigned int tst_tcase_idx(unsigned int *calls);
+
 #ifndef TST_NO_DEFAULT_MAIN
 
 static struct tst_test test;
@@ -41,6 +41,10 @@
 	.sample = sample,
     };
 
+    With the -t option the sampling function runs concurrently in several
+    threads, each pinned to a different CPU, so it must not modify any shared
+    state. The tests have to be linked with -lpthread.
+
   */
 
 #ifndef TST_TIMER_TEST__
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Calibrated cycle counter time source.
+ *
+ * If LTP_TSC is set in the environment the test library checks that the CPU
+ * has a constant rate cycle counter, i.e. invariant TSC on x86 or the generic
+ * timer virtual counter on aarch64, and calibrates it against
+ * CLOCK_MONOTONIC. The tst_fzsync_time() and tst_timer_*() functions then
+ * read the counter instead of calling clock_gettime().
+ *
+ * The timestamps are aligned with CLOCK_MONOTONIC at the time of the
+ * calibration, but are meant to be used for measuring time differences only.
+ */
+
+#ifndef TST_TSC_H__
+#define TST_TSC_H__
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+# define TST_HAS_TSC 1
+static inline uint64_t tst_tsc_read(void)
+{
+	uint32_t low, high;
+
+	/* lfence keeps the read from being speculated ahead */
+	__asm__ __volatile__ ("lfence; rdtsc" : "=a" (low), "=d" (high) : :
+			      "memory");
+
+	return (uint64_t)high << 32 | low;
+}
+#elif defined(__aarch64__)
+# define TST_HAS_TSC 1
+static inline uint64_t tst_tsc_read(void)
+{
+	uint64_t val;
+
+	/* isb keeps the read from being speculated ahead */
+	__asm__ __volatile__ ("isb; mrs %0, cntvct_el0" : "=r" (val) : : "memory");
+
+	return val;
+}
+#else
+static inline uint64_t tst_tsc_read(void)
+{
+	return 0;
+}
+#endif
+
+struct tst_tsc {
+	/* Set if the counter has been calibrated and should be used */
+	int enabled;
+	/* ns = base_ns + (cycles - base_cycles) * mult >> shift */
+	uint64_t base_cycles;
+	uint64_t base_ns;
+	uint64_t mult;
+	unsigned int shift;
+};
+
+extern struct tst_tsc tst_tsc;
+
+/*
+ * Checks and calibrates the counter if LTP_TSC is set, called by the test
+ * library before the test starts. Returns zero if the counter is used.
+ */
+int tst_tsc_init(void);
+
+static inline uint64_t tst_tsc_ns(uint64_t cycles)
+{
+	uint64_t delta = cycles - tst_tsc.base_cycles;
+
+	/* Split the multiplication so that it does not overflow */
+	return tst_tsc.base_ns
+		+ (((delta >> 32) * tst_tsc.mult) << (32 - tst_tsc.shift))
+		+ (((delta & 0xffffffff) * tst_tsc.mult) >> tst_tsc.shift);
+}
+
+static inline void tst_tsc_gettime(struct timespec *ts)
+{
+	uint64_t ns = tst_tsc_ns(tst_tsc_read());
+
+	ts->tv_sec = ns / 1000000000;
+	ts->tv_nsec = ns % 1000000000;
+}
+
+#endif /* TST_TSC_H__ */
@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Benchmark library test, measures getppid() syscall latency.
+ */
+
+#include "tst_test.h"
+#include "lapi/syscalls.h"
+
+static void bench(void)
+{
+	tst_syscall(__NR_getppid);
+}
+
+static struct tst_test test = {
+	.bench = bench,
+	.bench_iterations = 100000,
+	.bench_time_ms = 2000,
+};
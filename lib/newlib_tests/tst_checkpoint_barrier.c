@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Checkpoint barrier, named checkpoints and checkpoint area larger than a
+ * page.
+ */
+
+#include <stdlib.h>
+#include "tst_test.h"
+
+#define CHILDREN 16
+#define ROUNDS 100
+#define CHECKPOINTS 2000
+
+static void child(void)
+{
+	unsigned int id = TST_CHECKPOINT_ID("done");
+	int i;
+
+	for (i = 0; i < ROUNDS; i++)
+		TST_CHECKPOINT_BARRIER(CHECKPOINTS - 1, CHILDREN + 1);
+
+	TST_CHECKPOINT_WAIT(id);
+	exit(0);
+}
+
+static void run(void)
+{
+	unsigned int id;
+	int i;
+
+	for (i = 0; i < CHILDREN; i++) {
+		if (!SAFE_FORK())
+			child();
+	}
+
+	for (i = 0; i < ROUNDS; i++)
+		TST_CHECKPOINT_BARRIER(CHECKPOINTS - 1, CHILDREN + 1);
+
+	id = TST_CHECKPOINT_ID("done");
+	tst_res(TINFO, "Checkpoint 'done' has id %u", id);
+
+	if (id < CHECKPOINTS)
+		tst_res(TFAIL, "Named id overlaps numeric ids < %u", CHECKPOINTS);
+
+	TST_CHECKPOINT_WAKE2(id, CHILDREN);
+
+	tst_reap_children();
+
+	tst_res(TPASS, "%i processes passed %i barriers", CHILDREN + 1, ROUNDS);
+}
+
+static struct tst_test test = {
+	.test_all = run,
+	.forks_child = 1,
+	.max_checkpoints = CHECKPOINTS,
+};
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Checks that all tst_crc32c() implementations agree with the bytewise table
+ * one, both in one go and streamed in odd sized chunks, and reports their
+ * throughput.
+ */
+
+#include <stdlib.h>
+#include "tst_test.h"
+#include "tst_timer.h"
+#include "tst_checksum.h"
+
+#define BUF_SIZE (1024 * 1024)
+#define BENCH_MS 200
+
+static uint8_t *buf;
+
+static const struct impl {
+	int impl;
+	const char *name;
+} impls[] = {
+	{TST_CRC32C_TABLE, "table"},
+	{TST_CRC32C_SLICE8, "slice8"},
+	{TST_CRC32C_HW, "hw"},
+};
+
+static uint32_t crc_with(int impl, uint8_t *data, size_t len)
+{
+	tst_crc32c_set_impl(impl);
+
+	return tst_crc32c(data, len);
+}
+
+static uint32_t crc_streamed(uint8_t *data, size_t len)
+{
+	struct tst_crc32c ctx;
+	size_t chunk, off = 0;
+
+	tst_crc32c_init(&ctx);
+
+	for (chunk = 1; off < len; chunk = chunk * 3 + 1) {
+		chunk = MIN(chunk, len - off);
+		tst_crc32c_update(&ctx, data + off, chunk);
+		off += chunk;
+	}
+
+	return tst_crc32c_final(&ctx);
+}
+
+static int check(int impl)
+{
+	static const size_t offs[] = {0, 1, 3, 7};
+	static const size_t lens[] = {0, 1, 7, 8, 9, 63, 4097, BUF_SIZE - 7};
+	uint32_t ref, crc;
+	unsigned int i, j;
+
+	crc = crc_with(impl, (uint8_t *)"123456789", 9);
+	if (crc != 0xe3069283) {
+		tst_res(TFAIL, "crc32c(\"123456789\") = %08x, expected e3069283",
+			crc);
+		return 1;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(offs); i++) {
+		for (j = 0; j < ARRAY_SIZE(lens); j++) {
+			ref = crc_with(TST_CRC32C_TABLE, buf + offs[i], lens[j]);
+			crc = crc_with(impl, buf + offs[i], lens[j]);
+
+			if (crc != ref) {
+				tst_res(TFAIL, "offset %zu len %zu: %08x != %08x",
+					offs[i], lens[j], crc, ref);
+				return 1;
+			}
+
+			if (crc_streamed(buf + offs[i], lens[j]) != ref) {
+				tst_res(TFAIL, "offset %zu len %zu: streamed crc differs",
+					offs[i], lens[j]);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void run(unsigned int n)
+{
+	const struct impl *impl = &impls[n];
+	unsigned long long bytes = 0;
+	long long us;
+
+	if (tst_crc32c_set_impl(impl->impl)) {
+		tst_res(TCONF, "%s crc32c not supported", impl->name);
+		return;
+	}
+
+	if (check(impl->impl))
+		return;
+
+	tst_timer_start(CLOCK_MONOTONIC);
+
+	do {
+		tst_crc32c(buf, BUF_SIZE);
+		bytes += BUF_SIZE;
+	} while (!tst_timer_expired_ms(BENCH_MS));
+
+	tst_timer_stop();
+	us = tst_timer_elapsed_us();
+
+	tst_res(TPASS, "%s crc32c %.1f MB/s", tst_crc32c_impl_name(),
+		(double)bytes / us);
+}
+
+static void setup(void)
+{
+	size_t i;
+
+	buf = SAFE_MALLOC(BUF_SIZE);
+
+	srand(42);
+	for (i = 0; i < BUF_SIZE; i++)
+		buf[i] = rand();
+}
+
+static void cleanup(void)
+{
+	free(buf);
+	tst_crc32c_set_impl(TST_CRC32C_AUTO);
+}
+
+static struct tst_test test = {
+	.tcnt = ARRAY_SIZE(impls),
+	.test = run,
+	.setup = setup,
+	.cleanup = cleanup,
+};
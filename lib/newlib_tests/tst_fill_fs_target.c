@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Fills a freshly formatted filesystem with tst_fill_fs_target() and checks
+ * that the target fill level has been reached, also when the filesystem is
+ * filled in two steps.
+ */
+
+#include <sys/statvfs.h>
+#include <errno.h>
+#include "tst_test.h"
+#include "tst_fs.h"
+
+#define MNTPOINT "mntpoint"
+
+static const struct tcase {
+	unsigned int first;
+	unsigned int percent;
+	int mode;
+	const char *desc;
+} tcases[] = {
+	{0, 50, TST_FILL_BLOCKS, "50% of blocks"},
+	{0, 100, TST_FILL_BLOCKS, "all blocks"},
+	{0, 100, TST_FILL_INODES, "all inodes"},
+	{50, 80, TST_FILL_BLOCKS, "50% then 80% of blocks"},
+	{50, 100, TST_FILL_INODES, "50% then all inodes"},
+};
+
+static int mounted;
+
+static unsigned int used_percent(const struct tcase *tc)
+{
+	struct statvfs sb;
+
+	if (statvfs(MNTPOINT, &sb))
+		tst_brk(TBROK | TERRNO, "statvfs()");
+
+	if (tc->mode == TST_FILL_INODES)
+		return 100 - 100 * sb.f_ffree / sb.f_files;
+
+	return 100 - 100 * sb.f_bfree / sb.f_blocks;
+}
+
+/*
+ * Some filesystems keep a few percent of blocks for metadata, so check that
+ * there is no space left instead of looking at the numbers.
+ */
+static int is_full(const struct tcase *tc)
+{
+	static char buf[64 * 1024];
+	int i, fd, ret = 0;
+
+	fd = open(MNTPOINT "/last", O_WRONLY | O_CREAT, 0600);
+	if (fd < 0 || tc->mode == TST_FILL_INODES) {
+		if (fd < 0 && errno == ENOSPC)
+			return 1;
+
+		tst_res(TFAIL | TERRNO, "open() did not fail with ENOSPC");
+		goto out;
+	}
+
+	for (i = 0; i < 16; i++) {
+		if (write(fd, buf, sizeof(buf)) < 0)
+			break;
+	}
+
+	if (i < 16 && errno == ENOSPC)
+		ret = 1;
+	else
+		tst_res(TFAIL | TERRNO, "write() did not fail with ENOSPC");
+
+out:
+	if (fd >= 0)
+		SAFE_CLOSE(fd);
+
+	return ret;
+}
+
+static void run(unsigned int n)
+{
+	const struct tcase *tc = &tcases[n];
+	unsigned int used;
+
+	SAFE_MKFS(tst_device->dev, tst_device->fs_type, NULL, NULL);
+	SAFE_MOUNT(tst_device->dev, MNTPOINT, tst_device->fs_type, 0, NULL);
+	mounted = 1;
+
+	tst_res(TINFO, "Filling %s", tc->desc);
+
+	if (tc->first)
+		tst_fill_fs_target(MNTPOINT, tc->first, tc->mode);
+
+	tst_fill_fs_target(MNTPOINT, tc->percent, tc->mode);
+
+	used = used_percent(tc);
+
+	if (tc->percent == 100) {
+		if (is_full(tc))
+			tst_res(TPASS, "Filesystem is full, used %u%%", used);
+	} else if (used < tc->percent || used > tc->percent + 5) {
+		tst_res(TFAIL, "Filled to %u%%, expected %u%%", used,
+			tc->percent);
+	} else {
+		tst_res(TPASS, "Filled to %u%%", used);
+	}
+
+	SAFE_UMOUNT(MNTPOINT);
+	mounted = 0;
+}
+
+static void cleanup(void)
+{
+	if (mounted)
+		SAFE_UMOUNT(MNTPOINT);
+}
+
+static struct tst_test test = {
+	.tcnt = ARRAY_SIZE(tcases),
+	.test = run,
+	.cleanup = cleanup,
+	.needs_root = 1,
+	.needs_device = 1,
+	.mntpoint = MNTPOINT,
+};
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Basic test for the N way fuzzy sync API. Three participants, started
+ * either as threads or as processes, bump their own iteration counter in the
+ * race window and participant 0 checks after each iteration that all of them
+ * have passed the same number of barriers.
+ */
+
+#include <sys/mman.h>
+#include "tst_test.h"
+#include "tst_fuzzy_sync.h"
+
+#define PARTICIPANTS 3
+#define LOOPS 1000
+
+struct shared {
+	struct tst_fzsync_group group;
+	int loops[PARTICIPANTS];
+	int out_of_sync;
+};
+
+static struct shared *shm;
+
+static void *worker(void *arg)
+{
+	int i = (long)arg;
+
+	while (tst_fzsync_group_run(&shm->group, i)) {
+		tst_fzsync_group_start_race(&shm->group, i);
+		shm->loops[i]++;
+		tst_fzsync_group_end_race(&shm->group, i);
+	}
+
+	return NULL;
+}
+
+static void run(unsigned int n)
+{
+	struct tst_fzsync_group *group = &shm->group;
+	int i, loops = 0;
+
+	memset(shm, 0, sizeof(*shm));
+
+	group->participants = PARTICIPANTS;
+	group->processes = n;
+	group->exec_loops = LOOPS;
+	tst_fzsync_group_init(group);
+
+	tst_res(TINFO, "Racing %i %s", PARTICIPANTS,
+		n ? "processes" : "threads");
+
+	tst_fzsync_group_reset(group, worker);
+	while (tst_fzsync_group_run(group, 0)) {
+		tst_fzsync_group_start_race(group, 0);
+		shm->loops[0]++;
+		tst_fzsync_group_end_race(group, 0);
+
+		for (i = 1; i < PARTICIPANTS; i++) {
+			if (shm->loops[i] != shm->loops[0])
+				shm->out_of_sync++;
+		}
+
+		loops++;
+	}
+
+	tst_fzsync_group_cleanup(group);
+
+	if (shm->out_of_sync)
+		tst_res(TFAIL, "Participants out of sync %i times",
+			shm->out_of_sync);
+	else
+		tst_res(TPASS, "Participants stayed in sync for %i loops",
+			loops);
+
+	for (i = 1; i < PARTICIPANTS; i++) {
+		if (shm->loops[i] != loops) {
+			tst_res(TFAIL, "Participant %i did %i loops, expected %i",
+				i, shm->loops[i], loops);
+		}
+	}
+}
+
+static void setup(void)
+{
+	shm = SAFE_MMAP(NULL, sizeof(*shm), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+}
+
+static void cleanup(void)
+{
+	if (shm) {
+		tst_fzsync_group_cleanup(&shm->group);
+		SAFE_MUNMAP(shm, sizeof(*shm));
+	}
+}
+
+static struct tst_test test = {
+	.tcnt = 2,
+	.test = run,
+	.setup = setup,
+	.cleanup = cleanup,
+	.forks_child = 1,
+};
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Checks the tst_histogram bucket layout, compares the percentiles with the
+ * exact ones computed from sorted samples, checks that a histogram survives
+ * write and read and that percentiles of a few samples use the nearest rank.
+ */
+
+#include <stdlib.h>
+#include "tst_test.h"
+#include "tst_histogram.h"
+
+#define SAMPLES 100000
+
+static long long *samples;
+static struct tst_histogram *h1, *h2;
+
+static int cmp(const void *a, const void *b)
+{
+	const long long *aa = a, *bb = b;
+
+	return (*aa > *bb) - (*aa < *bb);
+}
+
+static void check_buckets(void)
+{
+	long long low, width;
+	unsigned int i;
+
+	for (i = 0; i < TST_HISTOGRAM_BUCKETS; i++) {
+		low = tst_histogram_bucket_low(i);
+		width = tst_histogram_bucket_width(i);
+
+		if (tst_histogram_index(low) != i
+		    || tst_histogram_index(low + width - 1) != i
+		    || (i && tst_histogram_index(low - 1) != i - 1)) {
+			tst_res(TFAIL, "bucket %u [%lli, %lli] is inconsistent",
+				i, low, low + width - 1);
+			return;
+		}
+	}
+
+	tst_res(TPASS, "%u buckets are consecutive", TST_HISTOGRAM_BUCKETS);
+}
+
+/* Values spread over many orders of magnitude */
+static long long rand_val(void)
+{
+	return (long long)rand() >> (rand() % 31);
+}
+
+static void check_percentiles(void)
+{
+	static const double percents[] = {1, 10, 50, 90, 99, 99.9, 100};
+	long long exact, approx, sum = 0;
+	unsigned int i, idx;
+	int failed = 0;
+
+	tst_histogram_reset(h1);
+	tst_histogram_reset(h2);
+
+	for (i = 0; i < SAMPLES; i++) {
+		samples[i] = rand_val();
+		tst_histogram_record(i % 2 ? h1 : h2, samples[i]);
+	}
+
+	tst_histogram_merge(h1, h2);
+	qsort(samples, SAMPLES, sizeof(*samples), cmp);
+
+	if (h1->count != SAMPLES || h1->min != samples[0]
+	    || h1->max != samples[SAMPLES - 1]) {
+		tst_res(TFAIL, "merged count %llu min %lli max %lli",
+			(unsigned long long)h1->count, h1->min, h1->max);
+		return;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(percents); i++) {
+		idx = MAX(1u, (unsigned int)(percents[i] * SAMPLES / 100)) - 1;
+		exact = samples[idx];
+		approx = tst_histogram_percentile(h1, percents[i]);
+
+		if (llabs(approx - exact) >
+		    (exact >> TST_HISTOGRAM_SUB_BITS) + 1) {
+			tst_res(TFAIL, "p%g is %lli, expected %lli",
+				percents[i], approx, exact);
+			failed = 1;
+		}
+	}
+
+	for (i = SAMPLES - SAMPLES / 20; i < SAMPLES; i++)
+		sum += samples[i];
+
+	approx = tst_histogram_sum_top(h1, SAMPLES / 20);
+	if (llabs(approx - sum) > (sum >> TST_HISTOGRAM_SUB_BITS)) {
+		tst_res(TFAIL, "sum of top 5%% is %lli, expected %lli",
+			approx, sum);
+		failed = 1;
+	}
+
+	if (!failed)
+		tst_res(TPASS, "Percentiles within relative error 2^-%i",
+			TST_HISTOGRAM_SUB_BITS);
+}
+
+/* Nearest rank with few samples, p99 of two samples is the larger one */
+static void check_small(void)
+{
+	long long p50, p99;
+
+	tst_histogram_reset(h1);
+	tst_histogram_record(h1, 10);
+	tst_histogram_record(h1, 1000);
+
+	p50 = tst_histogram_percentile(h1, 50);
+	p99 = tst_histogram_percentile(h1, 99);
+
+	if (p50 != 10 || p99 != 1000) {
+		tst_res(TFAIL, "p50 %lli p99 %lli of {10, 1000}", p50, p99);
+		return;
+	}
+
+	tst_res(TPASS, "Nearest rank percentiles of two samples");
+}
+
+static void check_file(void)
+{
+	FILE *f = tmpfile();
+
+	if (!f)
+		tst_brk(TBROK | TERRNO, "tmpfile()");
+
+	tst_histogram_write(h1, f);
+	rewind(f);
+
+	if (tst_histogram_read(h2, f)) {
+		tst_res(TFAIL, "tst_histogram_read() failed");
+	} else if (memcmp(h1, h2, sizeof(*h1))) {
+		tst_res(TFAIL, "Histogram read back differs");
+	} else {
+		tst_res(TPASS, "Histogram read back matches");
+	}
+
+	fclose(f);
+}
+
+static void run(void)
+{
+	check_buckets();
+	check_percentiles();
+	check_file();
+	check_small();
+}
+
+static void setup(void)
+{
+	samples = SAFE_MALLOC(sizeof(*samples) * SAMPLES);
+	h1 = tst_histogram_alloc();
+	h2 = tst_histogram_alloc();
+	srand(42);
+}
+
+static void cleanup(void)
+{
+	free(samples);
+	tst_histogram_free(h1);
+	tst_histogram_free(h2);
+}
+
+static struct tst_test test = {
+	.test_all = run,
+	.setup = setup,
+	.cleanup = cleanup,
+};
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Measures checkpoint round-trip latency, the parent and the child ping-pong
+ * over two checkpoints and the average time of one round-trip is printed.
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/wait.h>
+
+#include "test.h"
+
+#define ROUND_TRIPS 10000
+
+char *TCID = "tst_checkpoint_bench";
+int TST_TOTAL = 1;
+
+static void cleanup(void)
+{
+	tst_rmdir();
+}
+
+int main(int argc, char *argv[])
+{
+	struct timespec start, end;
+	long long elapsed;
+	int i, pid, round_trips = ROUND_TRIPS;
+	char *end_ptr;
+	long val;
+
+	if (argc > 1) {
+		errno = 0;
+		val = strtol(argv[1], &end_ptr, 10);
+
+		if (errno || end_ptr == argv[1] || *end_ptr || val <= 0 ||
+		    val > INT_MAX)
+			tst_brkm(TBROK, NULL, "Invalid round trips count '%s'",
+				 argv[1]);
+
+		round_trips = val;
+	}
+
+	tst_tmpdir();
+
+	TST_CHECKPOINT_INIT(cleanup);
+
+	pid = fork();
+
+	switch (pid) {
+	case -1:
+		tst_brkm(TBROK | TERRNO, cleanup, "Fork failed");
+	break;
+	case 0:
+		for (i = 0; i < round_trips; i++) {
+			TST_SAFE_CHECKPOINT_WAIT(NULL, 0);
+			TST_SAFE_CHECKPOINT_WAKE(NULL, 1);
+		}
+		exit(0);
+	break;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < round_trips; i++) {
+		TST_SAFE_CHECKPOINT_WAKE(cleanup, 0);
+		TST_SAFE_CHECKPOINT_WAIT(cleanup, 1);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	wait(NULL);
+
+	elapsed = (end.tv_sec - start.tv_sec) * 1000000000LL +
+		  end.tv_nsec - start.tv_nsec;
+
+	fprintf(stderr, "%i round-trips, %lli ns per round-trip\n",
+		round_trips, elapsed / round_trips);
+
+	cleanup();
+	return 0;
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Two wakers compete for a single waiter, exactly one of them has to succeed
+ * and the other one has to time out. Also checks that no wake is left over
+ * for the next waiter.
+ */
+
+#include <sys/wait.h>
+
+#include "test.h"
+
+char *TCID = "tst_checkpoint_wakers";
+int TST_TOTAL = 1;
+
+#define WAKERS 2
+
+static void cleanup(void)
+{
+	tst_rmdir();
+}
+
+int main(void)
+{
+	int i, pid, status, ok = 0, failed = 0;
+
+	tst_tmpdir();
+
+	TST_CHECKPOINT_INIT(cleanup);
+
+	for (i = 0; i < WAKERS; i++) {
+		pid = fork();
+		if (pid < 0)
+			tst_brkm(TBROK | TERRNO, cleanup, "Fork failed");
+
+		if (!pid)
+			exit(!!tst_checkpoint_wake(0, 1, 1000));
+	}
+
+	/* Let both wakers wait for the waiter */
+	usleep(100000);
+
+	if (tst_checkpoint_wait(0, 2000))
+		tst_brkm(TBROK | TERRNO, cleanup, "Waiter was not woken");
+
+	for (i = 0; i < WAKERS; i++) {
+		wait(&status);
+
+		if (WIFEXITED(status) && !WEXITSTATUS(status))
+			ok++;
+		else
+			failed++;
+	}
+
+	if (!tst_checkpoint_wait(0, 100)) {
+		tst_resm(TFAIL, "Second waiter passed without a wake");
+	} else if (ok != 1 || failed != 1) {
+		tst_resm(TFAIL, "%i wakers succeeded, %i timed out, "
+			 "expected 1 and 1", ok, failed);
+	} else {
+		tst_resm(TPASS, "Exactly one waker succeeded");
+	}
+
+	cleanup();
+	tst_exit();
+}
@@ -0,0 +1,472 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <sys/stat.h>
+#include <sys/utsname.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_clocks.h"
+#include "tst_timer.h"
+#include "tst_minmax.h"
+#include "tst_bench.h"
+#include "tst_histogram.h"
+
+#define DEFAULT_WARMUP 10
+#define DEFAULT_ITERATIONS 1000
+/* Median slowdown in percent for TWARN and TFAIL and the significance level */
+#define DEFAULT_WARN 5
+#define DEFAULT_FAIL 20
+#define DEFAULT_ALPHA 0.01
+
+static void (*bench)(void);
+static unsigned int warmup;
+static unsigned int iterations;
+static unsigned int time_ms;
+
+static long long *samples;
+static unsigned int nsamples;
+static unsigned int samples_size;
+
+static void add_sample(long long ns)
+{
+	if (nsamples >= samples_size) {
+		samples_size = MAX(1024u, 2 * samples_size);
+		samples = realloc(samples, samples_size * sizeof(*samples));
+		if (!samples)
+			tst_brk(TBROK | TERRNO, "realloc() failed");
+	}
+
+	samples[nsamples++] = ns;
+}
+
+static int cmp(const void *a, const void *b)
+{
+	const long long *aa = a, *bb = b;
+
+	return (*aa > *bb) - (*aa < *bb);
+}
+
+/* Newton's method, avoids linking all tests with -lm */
+static double sqrt_newton(double x)
+{
+	double r = x;
+	int i;
+
+	if (x <= 0)
+		return 0;
+
+	for (i = 0; i < 100; i++) {
+		double next = (r + x / r) / 2;
+
+		if (next == r)
+			break;
+
+		r = next;
+	}
+
+	return r;
+}
+
+/* e^x for x <= 0, avoids -lm as well */
+static double exp_neg(double x)
+{
+	double r = 1, term = 1;
+	int i, halvings = 0;
+
+	if (x < -700)
+		return 0;
+
+	while (x < -0.5) {
+		x /= 2;
+		halvings++;
+	}
+
+	for (i = 1; i < 20; i++) {
+		term *= x / i;
+		r += term;
+	}
+
+	while (halvings--)
+		r *= r;
+
+	return r;
+}
+
+/* P(Z > z) for standard normal Z, Abramowitz & Stegun 26.2.17 */
+static double normal_tail(double z)
+{
+	double t, poly;
+
+	if (z < 0)
+		return 1 - normal_tail(-z);
+
+	t = 1 / (1 + 0.2316419 * z);
+	poly = t * (0.319381530 + t * (-0.356563782 + t * (1.781477937
+	       + t * (-1.821255978 + t * 1.330274429))));
+
+	return 0.398942280401 * exp_neg(-z * z / 2) * poly;
+}
+
+/* Nearest rank method, p is in per mille */
+static long long percentile(long long *sorted, unsigned int n, unsigned int p)
+{
+	unsigned long long rank = ((unsigned long long)p * n + 999) / 1000;
+
+	return sorted[rank ? rank - 1 : 0];
+}
+
+void tst_bench_stats(long long *samples, unsigned int nsamples,
+		     struct tst_bench_stats *stats)
+{
+	long long q1, q3, fence;
+	double sum = 0, sq_sum = 0, raw_sum = 0;
+	unsigned int i, kept = 0;
+
+	memset(stats, 0, sizeof(*stats));
+
+	if (!nsamples)
+		return;
+
+	qsort(samples, nsamples, sizeof(*samples), cmp);
+
+	stats->samples = nsamples;
+	stats->min = samples[0];
+	stats->max = samples[nsamples - 1];
+	stats->median = percentile(samples, nsamples, 500);
+	stats->p99 = percentile(samples, nsamples, 990);
+
+	q1 = percentile(samples, nsamples, 250);
+	q3 = percentile(samples, nsamples, 750);
+	/*
+	 * With quantized timings q1 == q3 is common and the fence would drop
+	 * every sample slower by a single tick, keep at least 10% above q3.
+	 */
+	fence = MAX(q3 + 3 * (q3 - q1), q3 + q3 / 10);
+
+	for (i = 0; i < nsamples && samples[i] <= fence; i++) {
+		sum += samples[i];
+		kept++;
+	}
+
+	for (i = 0; i < nsamples; i++)
+		raw_sum += samples[i];
+
+	stats->discarded = nsamples - kept;
+	stats->mean = sum / kept;
+	stats->raw_mean = raw_sum / nsamples;
+
+	for (i = 0; i < kept; i++)
+		sq_sum += (samples[i] - stats->mean) * (samples[i] - stats->mean);
+
+	stats->stddev = kept > 1 ? sqrt_newton(sq_sum / (kept - 1)) : 0;
+}
+
+static void write_results(const struct tst_bench_stats *stats)
+{
+	const char *path = getenv("LTP_BENCH_OUTPUT");
+	FILE *f;
+
+	if (!path)
+		return;
+
+	f = fopen(path, "a");
+	if (!f) {
+		tst_res(TWARN | TERRNO, "Failed to open '%s'", path);
+		return;
+	}
+
+	fprintf(f, "{\"test\":\"%s\",\"samples\":%u,\"discarded\":%u,"
+		"\"min_ns\":%lli,\"median_ns\":%lli,\"p99_ns\":%lli,"
+		"\"max_ns\":%lli,\"mean_ns\":%.2f,\"stddev_ns\":%.2f,"
+		"\"raw_mean_ns\":%.2f}\n",
+		TCID, stats->samples, stats->discarded, stats->min,
+		stats->median, stats->p99, stats->max, stats->mean,
+		stats->stddev, stats->raw_mean);
+
+	if (fclose(f))
+		tst_res(TWARN | TERRNO, "Failed to close file '%s'", path);
+}
+
+/*
+ * One sided Mann-Whitney U test, returns the probability that the current
+ * samples are not larger than the baseline. The samples are compared at the
+ * histogram bucket resolution, samples in the same bucket are ties.
+ */
+static double mann_whitney(const struct tst_histogram *base,
+			   const struct tst_histogram *cur)
+{
+	double n1 = base->count, n2 = cur->count, n = n1 + n2;
+	double rank = 0, rank_sum = 0, ties = 0, t;
+	double u, mean, var;
+	unsigned int i;
+
+	for (i = 0; i < TST_HISTOGRAM_BUCKETS; i++) {
+		t = (double)base->buckets[i] + cur->buckets[i];
+
+		if (!t)
+			continue;
+
+		rank_sum += cur->buckets[i] * (rank + (t + 1) / 2);
+		ties += t * t * t - t;
+		rank += t;
+	}
+
+	u = rank_sum - n2 * (n2 + 1) / 2;
+	mean = n1 * n2 / 2;
+	var = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)));
+
+	if (var <= 0)
+		return 1;
+
+	return normal_tail((u - mean - 0.5) / sqrt_newton(var));
+}
+
+static double threshold_warn = DEFAULT_WARN;
+static double threshold_fail = DEFAULT_FAIL;
+static double threshold_alpha = DEFAULT_ALPHA;
+
+void tst_bench_parse_threshold(void)
+{
+	const char *str = getenv("LTP_BENCH_THRESHOLD");
+
+	if (!str)
+		return;
+
+	if (sscanf(str, "%lf:%lf:%lf", &threshold_warn, &threshold_fail,
+		   &threshold_alpha) < 1 || threshold_warn < 0
+	    || threshold_fail < threshold_warn || threshold_alpha <= 0
+	    || threshold_alpha >= 1) {
+		tst_brk(TBROK, "Invalid LTP_BENCH_THRESHOLD='%s', "
+			"expected warn%%[:fail%%[:alpha]]", str);
+	}
+}
+
+static int load_histogram(const char *path, struct tst_histogram *h)
+{
+	FILE *f = fopen(path, "r");
+	int ret;
+
+	if (!f)
+		return 1;
+
+	ret = tst_histogram_read(h, f);
+	fclose(f);
+
+	return ret;
+}
+
+static void compare_baseline(const char *metric, const char *path,
+			     const char *release,
+			     const struct tst_histogram *base,
+			     const struct tst_histogram *cur)
+{
+	long long base_median, cur_median;
+	double change, p;
+	int ttype = TINFO;
+
+	if (!base->count || !cur->count) {
+		tst_res(TINFO, "No %s baseline samples in %s", release, path);
+		return;
+	}
+
+	base_median = tst_histogram_percentile(base, 50);
+	cur_median = tst_histogram_percentile(cur, 50);
+	change = 100.00 * (cur_median - base_median) / MAX(base_median, 1LL);
+	p = mann_whitney(base, cur);
+
+	if (p < threshold_alpha && change >= threshold_fail)
+		ttype = TFAIL;
+	else if (p < threshold_alpha && change >= threshold_warn)
+		ttype = TWARN;
+
+	tst_res(ttype, "%s median %lli -> %lli (%+.1f%%) against %s baseline, "
+		"Mann-Whitney p=%.3g", metric, base_median, cur_median, change,
+		release, p);
+}
+
+static int mkdir_exist(const char *path)
+{
+	if (mkdir(path, 0755) && errno != EEXIST) {
+		tst_res(TWARN | TERRNO, "mkdir(%s)", path);
+		return 1;
+	}
+
+	return 0;
+}
+
+static void append_result(const char *dir, const char *metric,
+			  const struct utsname *uts,
+			  const struct tst_histogram *h)
+{
+	char path[PATH_MAX];
+	FILE *f;
+
+	snprintf(path, sizeof(path), "%s/results", dir);
+
+	f = fopen(path, "a");
+	if (!f) {
+		tst_res(TWARN | TERRNO, "Failed to open '%s'", path);
+		return;
+	}
+
+	fprintf(f, "{\"test\":\"%s\",\"metric\":\"%s\",\"host\":\"%s\","
+		"\"release\":\"%s\",\"time\":%lli,\"samples\":%llu,"
+		"\"min\":%lli,\"median\":%lli,\"p99\":%lli,\"max\":%lli}\n",
+		TCID, metric, uts->nodename, uts->release, (long long)time(NULL),
+		(unsigned long long)h->count, h->min,
+		tst_histogram_percentile(h, 50),
+		tst_histogram_percentile(h, 99), h->max);
+
+	if (fclose(f))
+		tst_res(TWARN | TERRNO, "Failed to close file '%s'", path);
+}
+
+void tst_bench_store(const char *metric, const struct tst_histogram *h)
+{
+	const char *dir = getenv("LTP_BENCH_STORE");
+	const char *baseline = getenv("LTP_BENCH_BASELINE");
+	char path[PATH_MAX], tmp[PATH_MAX + 16];
+	struct tst_histogram *stored;
+	struct utsname uts;
+	FILE *f;
+
+	if (!dir || !h->count)
+		return;
+
+	if (uname(&uts))
+		tst_brk(TBROK | TERRNO, "uname()");
+
+	stored = tst_histogram_alloc();
+
+	/* Load the baseline first, it may be the release we store into */
+	if (baseline) {
+		snprintf(path, sizeof(path), "%s/%s/%s/%s.%s", dir,
+			 uts.nodename, baseline, TCID, metric);
+		load_histogram(path, stored);
+		compare_baseline(metric, path, baseline, stored, h);
+	}
+
+	snprintf(path, sizeof(path), "%s/%s", dir, uts.nodename);
+	if (mkdir_exist(dir) || mkdir_exist(path))
+		goto out;
+
+	snprintf(path, sizeof(path), "%s/%s/%s", dir, uts.nodename,
+		 uts.release);
+	if (mkdir_exist(path))
+		goto out;
+
+	snprintf(path, sizeof(path), "%s/%s/%s/%s.%s", dir, uts.nodename,
+		 uts.release, TCID, metric);
+	snprintf(tmp, sizeof(tmp), "%s.%i", path, getpid());
+
+	if (load_histogram(path, stored))
+		tst_histogram_reset(stored);
+
+	tst_histogram_merge(stored, h);
+
+	f = fopen(tmp, "w");
+	if (!f) {
+		tst_res(TWARN | TERRNO, "Failed to open '%s'", tmp);
+		goto out;
+	}
+
+	tst_histogram_write(stored, f);
+
+	if (fclose(f) || rename(tmp, path)) {
+		tst_res(TWARN | TERRNO, "Failed to store '%s'", path);
+		unlink(tmp);
+		goto out;
+	}
+
+	append_result(dir, metric, &uts, h);
+out:
+	tst_histogram_free(stored);
+}
+
+static long long now_ns(void)
+{
+	struct timespec ts;
+
+	tst_clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return tst_timespec_to_ns(ts);
+}
+
+static void bench_run(void)
+{
+	struct tst_bench_stats stats;
+	long long start, end, stop = 0;
+	unsigned int i;
+
+	for (i = 0; i < warmup; i++)
+		bench();
+
+	nsamples = 0;
+
+	if (time_ms)
+		stop = now_ns() + time_ms * 1000000LL;
+
+	for (i = 0; !iterations || i < iterations; i++) {
+		start = now_ns();
+		bench();
+		end = now_ns();
+
+		add_sample(end - start);
+
+		if (stop && end >= stop)
+			break;
+	}
+
+	tst_bench_stats(samples, nsamples, &stats);
+
+	tst_res(TINFO, "%u samples (%u warmup), min %llins, median %llins, "
+		"p99 %llins, max %llins", stats.samples, warmup, stats.min,
+		stats.median, stats.p99, stats.max);
+
+	tst_res(TINFO, "mean %.2fns, stddev %.2fns (discarded %u outliers, "
+		"untrimmed mean %.2fns)", stats.mean, stats.stddev,
+		stats.discarded, stats.raw_mean);
+
+	write_results(&stats);
+
+	if (getenv("LTP_BENCH_STORE")) {
+		struct tst_histogram *h = tst_histogram_alloc();
+
+		for (i = 0; i < nsamples; i++)
+			tst_histogram_record(h, samples[i]);
+
+		tst_bench_store("ns", h);
+		tst_histogram_free(h);
+	}
+
+	tst_res(TPASS, "Benchmark finished");
+}
+
+struct tst_test *tst_bench_setup(struct tst_test *bench_test)
+{
+	bench = bench_test->bench;
+	warmup = bench_test->bench_warmup;
+	iterations = bench_test->bench_iterations;
+	time_ms = bench_test->bench_time_ms;
+
+	if (!warmup)
+		warmup = DEFAULT_WARMUP;
+
+	if (!iterations && !time_ms)
+		iterations = DEFAULT_ITERATIONS;
+
+	tst_bench_parse_threshold();
+
+	bench_test->bench = NULL;
+	bench_test->test_all = bench_run;
+
+	return bench_test;
+}
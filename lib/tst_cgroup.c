@@ -0,0 +1,425 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_fs.h"
+#include "tst_json.h"
+#include "tst_cgroup.h"
+
+/* How long to wait for the killed processes to leave the leaf */
+#define DRAIN_TIMEOUT_MS 10000
+
+enum {
+	CTRL_CPU = 1,
+	CTRL_MEMORY = 2,
+	CTRL_IO = 4,
+	CTRL_PIDS = 8,
+};
+
+static const struct controller {
+	const char *name;
+	int flag;
+} controllers[] = {
+	{"cpu", CTRL_CPU},
+	{"memory", CTRL_MEMORY},
+	{"io", CTRL_IO},
+	{"pids", CTRL_PIDS},
+};
+
+static char parent[PATH_MAX / 2];
+static char leaf[PATH_MAX / 2 + 128];
+static int enabled;
+static int kill_fd = -1;
+static unsigned int leaf_cnt;
+
+static int read_file(const char *dir, const char *name, char *buf, size_t size)
+{
+	char path[PATH_MAX];
+	ssize_t len;
+	int fd;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 1;
+
+	len = read(fd, buf, size - 1);
+	close(fd);
+
+	if (len < 0)
+		return 1;
+
+	buf[len] = 0;
+	return 0;
+}
+
+static int write_file(const char *dir, const char *name, const char *fmt, ...)
+	__attribute__ ((format (printf, 3, 4)));
+
+static int write_file(const char *dir, const char *name, const char *fmt, ...)
+{
+	char path[PATH_MAX], buf[64];
+	va_list va;
+	int fd, len, ret = 0;
+
+	va_start(va, fmt);
+	len = vsnprintf(buf, sizeof(buf), fmt, va);
+	va_end(va);
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+	fd = open(path, O_WRONLY);
+	if (fd < 0)
+		return 1;
+
+	if (write(fd, buf, len) != len)
+		ret = 1;
+
+	close(fd);
+	return ret;
+}
+
+/* The mount point of cgroup2 hierarchy and the cgroup we run in */
+static int find_own_cgroup(char *path, size_t size)
+{
+	char line[PATH_MAX * 2], mnt[PATH_MAX], cg[PATH_MAX];
+	const char *sep;
+	FILE *f;
+
+	mnt[0] = cg[0] = 0;
+
+	f = fopen("/proc/self/mountinfo", "r");
+	if (!f)
+		return 1;
+
+	while (fgets(line, sizeof(line), f)) {
+		sep = strstr(line, " - ");
+
+		if (sep && !strncmp(sep, " - cgroup2 ", 11)
+		    && sscanf(line, "%*s %*s %*s %*s %s", mnt) == 1)
+			break;
+
+		mnt[0] = 0;
+	}
+
+	fclose(f);
+
+	f = fopen("/proc/self/cgroup", "r");
+	if (!f)
+		return 1;
+
+	while (fgets(line, sizeof(line), f)) {
+		if (sscanf(line, "0::%s", cg) == 1)
+			break;
+	}
+
+	fclose(f);
+
+	if (!mnt[0] || !cg[0])
+		return 1;
+
+	snprintf(path, size, "%s%s", mnt, strcmp(cg, "/") ? cg : "");
+	return 0;
+}
+
+static void enable_controllers(void)
+{
+	char avail[256], sub[256];
+	unsigned int i;
+
+	if (read_file(parent, "cgroup.controllers", avail, sizeof(avail)))
+		avail[0] = 0;
+
+	for (i = 0; i < ARRAY_SIZE(controllers); i++) {
+		const char *name = controllers[i].name;
+
+		if (!strstr(avail, name)) {
+			tst_res(TINFO, "cgroup %s controller is not available in %s",
+				name, parent);
+			continue;
+		}
+
+		if (write_file(parent, "cgroup.subtree_control", "+%s", name)) {
+			tst_res(TINFO | TERRNO,
+				"Cannot enable %s controller in %s", name, parent);
+		}
+	}
+
+	if (read_file(parent, "cgroup.subtree_control", sub, sizeof(sub)))
+		return;
+
+	for (i = 0; i < ARRAY_SIZE(controllers); i++) {
+		if (strstr(sub, controllers[i].name))
+			enabled |= controllers[i].flag;
+	}
+}
+
+int tst_cgroup_init(void)
+{
+	const char *env = getenv("LTP_CGROUP");
+	struct statfs sb;
+
+	if (!env)
+		return 1;
+
+	if (env[0] == '/') {
+		snprintf(parent, sizeof(parent), "%s", env);
+	} else if (find_own_cgroup(parent, sizeof(parent))) {
+		tst_res(TINFO, "cgroup v2 is not mounted, LTP_CGROUP ignored");
+		return 1;
+	}
+
+	if (statfs(parent, &sb) || sb.f_type != TST_CGROUP2_MAGIC) {
+		tst_res(TINFO, "%s is not a cgroup v2 directory, "
+			"LTP_CGROUP ignored", parent);
+		return 1;
+	}
+
+	enable_controllers();
+
+	return 0;
+}
+
+static void set_limit(int ctrl, const char *file, const char *fmt,
+		      unsigned long long val)
+{
+	if (!(enabled & ctrl)) {
+		tst_res(TINFO, "Controller for %s not enabled, limit not applied",
+			file);
+		return;
+	}
+
+	if (write_file(leaf, file, fmt, val))
+		tst_res(TWARN | TERRNO, "Failed to set %s/%s", leaf, file);
+}
+
+void tst_cgroup_create(const struct tst_test *test)
+{
+	char path[PATH_MAX];
+
+	snprintf(leaf, sizeof(leaf), "%s/ltp_%s_%i_%u", parent, TCID,
+		 getpid(), leaf_cnt++);
+
+	if (mkdir(leaf, 0755))
+		tst_brk(TBROK | TERRNO, "mkdir(%s)", leaf);
+
+	/* cgroup.kill is available since 5.14 */
+	snprintf(path, sizeof(path), "%s/cgroup.kill", leaf);
+	kill_fd = open(path, O_WRONLY | O_CLOEXEC);
+
+	if (test->cgroup_memory_max) {
+		set_limit(CTRL_MEMORY, "memory.max", "%llu",
+			  test->cgroup_memory_max);
+	}
+
+	if (test->cgroup_pids_max)
+		set_limit(CTRL_PIDS, "pids.max", "%llu", test->cgroup_pids_max);
+
+	/* Percent of one CPU over the default 100ms period */
+	if (test->cgroup_cpu_max) {
+		set_limit(CTRL_CPU, "cpu.max", "%llu 100000",
+			  test->cgroup_cpu_max * 1000ULL);
+	}
+}
+
+void tst_cgroup_join(void)
+{
+	if (write_file(leaf, "cgroup.procs", "0"))
+		tst_brk(TBROK | TERRNO, "Failed to join %s", leaf);
+}
+
+void tst_cgroup_kill(void)
+{
+	if (kill_fd < 0)
+		return;
+
+	if (write(kill_fd, "1", 1)) {
+		/* https://gcc.gnu.org/bugzilla/show_bug.cgi?id=66425 */
+	}
+}
+
+/* Pre 5.14 fallback, the processes are killed one by one */
+static void kill_procs(void)
+{
+	char path[PATH_MAX];
+	FILE *f;
+	int pid;
+
+	snprintf(path, sizeof(path), "%s/cgroup.procs", leaf);
+
+	f = fopen(path, "r");
+	if (!f)
+		return;
+
+	while (fscanf(f, "%i", &pid) == 1)
+		kill(pid, SIGKILL);
+
+	fclose(f);
+}
+
+static int populated(void)
+{
+	char buf[256];
+	char *p;
+
+	if (read_file(leaf, "cgroup.events", buf, sizeof(buf)))
+		return 0;
+
+	p = strstr(buf, "populated ");
+
+	return p && p[10] == '1';
+}
+
+static void drain(void)
+{
+	int i;
+
+	for (i = 0; populated(); i++) {
+		if (i >= DRAIN_TIMEOUT_MS) {
+			tst_res(TWARN, "Processes left in %s", leaf);
+			return;
+		}
+
+		if (kill_fd >= 0)
+			tst_cgroup_kill();
+		else
+			kill_procs();
+
+		usleep(1000);
+	}
+}
+
+/* Reads "key value" from a flat keyed file */
+static int read_key(const char *file, const char *key, unsigned long long *val)
+{
+	char buf[1024], *p;
+	size_t len = strlen(key);
+
+	if (read_file(leaf, file, buf, sizeof(buf)))
+		return 1;
+
+	for (p = buf; p; p = strchr(p, '\n')) {
+		if (*p == '\n')
+			p++;
+
+		if (!strncmp(p, key, len) && p[len] == ' ')
+			return sscanf(p + len, "%llu", val) != 1;
+	}
+
+	return 1;
+}
+
+static int read_val(const char *file, unsigned long long *val)
+{
+	char buf[64];
+
+	if (read_file(leaf, file, buf, sizeof(buf)))
+		return 1;
+
+	return sscanf(buf, "%llu", val) != 1;
+}
+
+/* Sums rbytes and wbytes over all devices */
+static int read_io(unsigned long long *rbytes, unsigned long long *wbytes)
+{
+	char buf[4096], *p;
+	unsigned long long val;
+
+	if (read_file(leaf, "io.stat", buf, sizeof(buf)))
+		return 1;
+
+	*rbytes = *wbytes = 0;
+
+	for (p = buf; (p = strchr(p, ' ')); p++) {
+		if (sscanf(p, " rbytes=%llu", &val) == 1)
+			*rbytes += val;
+		else if (sscanf(p, " wbytes=%llu", &val) == 1)
+			*wbytes += val;
+	}
+
+	return 0;
+}
+
+#define APPEND(buf, fmt, ...) \
+	snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf), fmt, ##__VA_ARGS__)
+
+static void report(void)
+{
+	unsigned long long usage, user, sys, val, rbytes, wbytes;
+	char msg[512] = "", json[512] = "";
+
+	if (!read_key("cpu.stat", "usage_usec", &usage)
+	    && !read_key("cpu.stat", "user_usec", &user)
+	    && !read_key("cpu.stat", "system_usec", &sys)) {
+		APPEND(msg, "cpu %lluus (user %lluus, sys %lluus)",
+		       usage, user, sys);
+		APPEND(json, "\"usage_usec\":%llu,\"user_usec\":%llu,"
+		       "\"system_usec\":%llu", usage, user, sys);
+	}
+
+	if (!read_key("cpu.stat", "throttled_usec", &val) && val) {
+		APPEND(msg, ", throttled %lluus", val);
+		APPEND(json, ",\"throttled_usec\":%llu", val);
+	}
+
+	if (!read_val("memory.peak", &val)) {
+		APPEND(msg, ", memory peak %llukB", val / 1024);
+		APPEND(json, ",\"memory_peak\":%llu", val);
+	}
+
+	if (!read_key("memory.events", "oom_kill", &val) && val) {
+		APPEND(msg, ", oom kills %llu", val);
+		APPEND(json, ",\"oom_kill\":%llu", val);
+	}
+
+	if (!read_io(&rbytes, &wbytes)) {
+		APPEND(msg, ", io read %lluB write %lluB", rbytes, wbytes);
+		APPEND(json, ",\"rbytes\":%llu,\"wbytes\":%llu", rbytes, wbytes);
+	}
+
+	if (!read_val("pids.peak", &val)) {
+		APPEND(msg, ", pids peak %llu", val);
+		APPEND(json, ",\"pids_peak\":%llu", val);
+	}
+
+	if (!msg[0])
+		return;
+
+	tst_res(TINFO, "cgroup: %s", msg[0] == ',' ? msg + 2 : msg);
+	tst_json_event("cgroup", "%s", json[0] == ',' ? json + 1 : json);
+}
+
+void tst_cgroup_destroy(void)
+{
+	if (kill_fd >= 0)
+		tst_cgroup_kill();
+	else
+		kill_procs();
+
+	drain();
+	report();
+
+	if (kill_fd >= 0) {
+		close(kill_fd);
+		kill_fd = -1;
+	}
+
+	if (rmdir(leaf))
+		tst_res(TWARN | TERRNO, "rmdir(%s)", leaf);
+}
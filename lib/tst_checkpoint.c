@@ -24,6 +24,9 @@
 #include <stdint.h>
 #include <limits.h>
 #include <errno.h>
+#include <string.h>
+#include <sched.h>
+#include <time.h>
 #include <sys/syscall.h>
 #include <linux/futex.h>
 
@@ -82,46 +85,267 @@ void tst_checkpoint_init(const char *file, const int lineno,
 	SAFE_CLOSE(cleanup_fn, fd);
 }
 
-int tst_checkpoint_wait(unsigned int id, unsigned int msec_timeout)
+/*
+ * Each checkpoint consists of two futexes, the number of waiters that have
+ * arrived so far and the number of waiters that have been allowed to
+ * continue. Each waiter takes a ticket from the first counter and sleeps
+ * until the second one gets past it, the waker sleeps until there are enough
+ * waiters that were not woken yet and then moves the second counter. Both
+ * sides sleep in FUTEX_WAIT and are woken up as soon as the other side
+ * arrives.
+ */
+struct checkpoint {
+	futex_t arrived;
+	futex_t woken;
+};
+
+/*
+ * The end of the futex area holds a table that maps names to checkpoint ids,
+ * the names are hashed into the table and each entry owns one of the ids at
+ * the top of the id space. An entry is claimed by setting its state from
+ * free to busy, the name is filled in and the state set to valid.
+ */
+#define NAME_FREE 0
+#define NAME_BUSY 1
+#define NAME_VALID 2
+
+struct checkpoint_name {
+	futex_t state;
+	char name[TST_CHECKPOINT_NAME_MAX];
+};
+
+#define NAME_FUTEXES (sizeof(struct checkpoint_name) / sizeof(futex_t))
+
+static unsigned int nr_names(unsigned int nr_futexes)
+{
+	return nr_futexes / (4 * NAME_FUTEXES);
+}
+
+static unsigned int nr_ids(unsigned int nr_futexes)
+{
+	return (nr_futexes - nr_names(nr_futexes) * NAME_FUTEXES) / 2;
+}
+
+/*
+ * The named ids are the top nr_names() ids, so the area has to hold
+ * nr_checkpoints ids below them. The size is kept a multiple of the name
+ * table step, from there on the number of ids below the names never
+ * decreases, so rounding the area up to whole pages keeps the numeric ids
+ * [0, nr_checkpoints) out of the named range.
+ */
+unsigned int tst_checkpoint_futexes(unsigned int nr_checkpoints)
 {
-	struct timespec timeout;
+	unsigned int step = 4 * NAME_FUTEXES;
+	unsigned int nr_futexes = (2 * nr_checkpoints + step - 1) / step * step;
+
+	while (nr_ids(nr_futexes) - nr_names(nr_futexes) < nr_checkpoints)
+		nr_futexes += step;
+
+	return nr_futexes;
+}
 
-	if (id >= tst_max_futexes) {
+static struct checkpoint *get_checkpoint(unsigned int id)
+{
+	if (id >= nr_ids(tst_max_futexes)) {
 		errno = EOVERFLOW;
+		return NULL;
+	}
+
+	return (struct checkpoint *)&tst_futexes[2 * id];
+}
+
+int tst_checkpoint_id(const char *name)
+{
+	unsigned int i, idx, hash = 2166136261u;
+	unsigned int names = nr_names(tst_max_futexes);
+	struct checkpoint_name *table, *entry;
+	uint32_t state;
+	const char *p;
+
+	if (strlen(name) >= TST_CHECKPOINT_NAME_MAX) {
+		errno = ENAMETOOLONG;
 		return -1;
 	}
 
-	timeout.tv_sec = msec_timeout/1000;
-	timeout.tv_nsec = (msec_timeout%1000) * 1000000;
+	table = (void *)&tst_futexes[tst_max_futexes - names * NAME_FUTEXES];
 
-	return syscall(SYS_futex, &tst_futexes[id], FUTEX_WAIT,
-		       tst_futexes[id], &timeout);
+	for (p = name; *p; p++)
+		hash = (hash ^ (unsigned char)*p) * 16777619u;
+
+	for (i = 0; i < names; i++) {
+		idx = (hash + i) % names;
+		entry = &table[idx];
+		state = NAME_FREE;
+
+		if (__atomic_compare_exchange_n(&entry->state, &state,
+						NAME_BUSY, 0, __ATOMIC_SEQ_CST,
+						__ATOMIC_SEQ_CST)) {
+			strcpy(entry->name, name);
+			__atomic_store_n(&entry->state, NAME_VALID,
+					 __ATOMIC_SEQ_CST);
+			return nr_ids(tst_max_futexes) - names + idx;
+		}
+
+		while (state == NAME_BUSY) {
+			sched_yield();
+			state = __atomic_load_n(&entry->state, __ATOMIC_SEQ_CST);
+		}
+
+		if (!strcmp(entry->name, name))
+			return nr_ids(tst_max_futexes) - names + idx;
+	}
+
+	errno = ENOSPC;
+	return -1;
 }
 
-int tst_checkpoint_wake(unsigned int id, unsigned int nr_wake,
-                        unsigned int msec_timeout)
+static void set_deadline(struct timespec *deadline, unsigned int msec_timeout)
 {
-	unsigned int msecs = 0, waked = 0;
+	clock_gettime(CLOCK_MONOTONIC, deadline);
 
-	if (id >= tst_max_futexes) {
-		errno = EOVERFLOW;
+	deadline->tv_sec += msec_timeout / 1000;
+	deadline->tv_nsec += (msec_timeout % 1000) * 1000000;
+
+	if (deadline->tv_nsec >= 1000000000) {
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000;
+	}
+}
+
+/*
+ * Sleeps while *futex == val, returns -1 and sets errno to ETIMEDOUT once the
+ * deadline has passed.
+ */
+static int futex_wait_until(futex_t *futex, uint32_t val,
+			    const struct timespec *deadline)
+{
+	struct timespec now, timeout;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	timeout.tv_sec = deadline->tv_sec - now.tv_sec;
+	timeout.tv_nsec = deadline->tv_nsec - now.tv_nsec;
+
+	if (timeout.tv_nsec < 0) {
+		timeout.tv_sec--;
+		timeout.tv_nsec += 1000000000;
+	}
+
+	if (timeout.tv_sec < 0) {
+		errno = ETIMEDOUT;
 		return -1;
 	}
 
+	if (syscall(SYS_futex, futex, FUTEX_WAIT, val, &timeout) &&
+	    errno == ETIMEDOUT)
+		return -1;
+
+	return 0;
+}
+
+int tst_checkpoint_wait(unsigned int id, unsigned int msec_timeout)
+{
+	struct checkpoint *cp = get_checkpoint(id);
+	struct timespec deadline;
+	uint32_t ticket, woken, next;
+
+	if (!cp)
+		return -1;
+
+	set_deadline(&deadline, msec_timeout);
+
+	ticket = __atomic_fetch_add(&cp->arrived, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &cp->arrived, FUTEX_WAKE, INT_MAX, NULL);
+
 	for (;;) {
-		waked += syscall(SYS_futex, &tst_futexes[id], FUTEX_WAKE,
-				 INT_MAX, NULL);
+		woken = __atomic_load_n(&cp->woken, __ATOMIC_SEQ_CST);
+
+		if ((int32_t)(woken - ticket) > 0)
+			return 0;
 
-		if (waked == nr_wake)
+		if (futex_wait_until(&cp->woken, woken, &deadline))
 			break;
+	}
 
-		usleep(1000);
-		msecs++;
+	/* Give the ticket back unless another waiter has arrived since */
+	next = ticket + 1;
+	__atomic_compare_exchange_n(&cp->arrived, &next, ticket, 0,
+				    __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
 
-		if (msecs >= msec_timeout) {
-			errno = ETIMEDOUT;
-			return -1;
+	return -1;
+}
+
+int tst_checkpoint_wake(unsigned int id, unsigned int nr_wake,
+                        unsigned int msec_timeout)
+{
+	struct checkpoint *cp = get_checkpoint(id);
+	struct timespec deadline;
+	uint32_t arrived, woken;
+
+	if (!cp)
+		return -1;
+
+	set_deadline(&deadline, msec_timeout);
+
+	/*
+	 * Concurrent wakers compete for the same waiters, the wake is claimed
+	 * only if woken has not moved since the waiters were counted.
+	 */
+	for (;;) {
+		woken = __atomic_load_n(&cp->woken, __ATOMIC_SEQ_CST);
+		arrived = __atomic_load_n(&cp->arrived, __ATOMIC_SEQ_CST);
+
+		if ((int32_t)(arrived - woken) >= (int32_t)nr_wake) {
+			if (__atomic_compare_exchange_n(&cp->woken, &woken,
+							woken + nr_wake, 0,
+							__ATOMIC_SEQ_CST,
+							__ATOMIC_SEQ_CST))
+				break;
+			continue;
 		}
+
+		if (futex_wait_until(&cp->arrived, arrived, &deadline))
+			return -1;
+	}
+
+	syscall(SYS_futex, &cp->woken, FUTEX_WAKE, INT_MAX, NULL);
+
+	return 0;
+}
+
+int tst_checkpoint_barrier(unsigned int id, unsigned int nr,
+			   unsigned int msec_timeout)
+{
+	struct checkpoint *cp = get_checkpoint(id);
+	struct timespec deadline;
+	uint32_t round, arrived;
+
+	if (!cp)
+		return -1;
+
+	if (!nr) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	set_deadline(&deadline, msec_timeout);
+
+	/*
+	 * The woken counter is the barrier round, the last process to arrive
+	 * moves it to the next one and wakes up the rest.
+	 */
+	round = __atomic_load_n(&cp->woken, __ATOMIC_SEQ_CST);
+	arrived = __atomic_add_fetch(&cp->arrived, 1, __ATOMIC_SEQ_CST);
+
+	if (!(arrived % nr)) {
+		__atomic_add_fetch(&cp->woken, 1, __ATOMIC_SEQ_CST);
+		syscall(SYS_futex, &cp->woken, FUTEX_WAKE, INT_MAX, NULL);
+		return 0;
+	}
+
+	while (__atomic_load_n(&cp->woken, __ATOMIC_SEQ_CST) == round) {
+		if (futex_wait_until(&cp->woken, round, &deadline))
+			return -1;
 	}
 
 	return 0;
@@ -157,3 +381,35 @@ void tst_safe_checkpoint_wake(const char *file, const int lineno,
 		         file, lineno, id, nr_wake, DEFAULT_MSEC_TIMEOUT);
 	}
 }
+
+void tst_safe_checkpoint_barrier(const char *file, const int lineno,
+                                 void (*cleanup_fn)(void), unsigned int id,
+                                 unsigned int nr)
+{
+	int ret = tst_checkpoint_barrier(id, nr, DEFAULT_MSEC_TIMEOUT);
+
+	if (ret) {
+		tst_brkm(TBROK | TERRNO, cleanup_fn,
+		         "%s:%d: tst_checkpoint_barrier(%u, %u, %i)",
+		         file, lineno, id, nr, DEFAULT_MSEC_TIMEOUT);
+	}
+}
+
+unsigned int tst_safe_checkpoint_id(const char *file, const int lineno,
+                                    void (*cleanup_fn)(void), const char *name)
+{
+	int id = tst_checkpoint_id(name);
+
+	if (id < 0 && errno == ENOSPC) {
+		tst_brkm(TBROK, cleanup_fn,
+		         "%s:%d: tst_checkpoint_id(%s): all %u names are taken",
+		         file, lineno, name, nr_names(tst_max_futexes));
+	}
+
+	if (id < 0) {
+		tst_brkm(TBROK | TERRNO, cleanup_fn,
+		         "%s:%d: tst_checkpoint_id(%s)", file, lineno, name);
+	}
+
+	return id;
+}
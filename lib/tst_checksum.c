@@ -1,8 +1,16 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 /* Copyright (c) 2018 Oracle and/or its affiliates. All Rights Reserved. */
 
+#include <string.h>
+#if defined(__aarch64__)
+# include <sys/auxv.h>
+#endif
 #include "tst_checksum.h"
 
+#if defined(__aarch64__) && !defined(HWCAP_CRC32)
+# define HWCAP_CRC32 (1 << 7)
+#endif
+
 static const uint32_t crc32c_table[] = {
 	0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4,
 	0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
@@ -70,12 +78,208 @@ static const uint32_t crc32c_table[] = {
 	0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
 };
 
+static uint32_t crc32c_slice_table[8][256];
+static int crc32c_slice_ready;
+
+static uint32_t crc32c_table_update(uint32_t crc, const uint8_t *buf,
+				    size_t len)
+{
+	while (len--)
+		crc = crc32c_table[(crc ^ (*buf++)) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+
+/*
+ * Table k maps a byte to its CRC followed by k zero bytes, so that eight
+ * bytes are processed by eight independent lookups.
+ */
+static void crc32c_slice_init(void)
+{
+	uint32_t (*t)[256] = crc32c_slice_table;
+	int i, k;
+
+	if (__atomic_load_n(&crc32c_slice_ready, __ATOMIC_ACQUIRE))
+		return;
+
+	for (i = 0; i < 256; i++) {
+		t[0][i] = crc32c_table[i];
+
+		for (k = 1; k < 8; k++)
+			t[k][i] = (t[k-1][i] >> 8) ^ crc32c_table[t[k-1][i] & 0xff];
+	}
+
+	__atomic_store_n(&crc32c_slice_ready, 1, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t get_le32(const uint8_t *buf)
+{
+	return buf[0] | buf[1] << 8 | buf[2] << 16 | (uint32_t)buf[3] << 24;
+}
+
+static uint32_t crc32c_slice8_update(uint32_t crc, const uint8_t *buf,
+				     size_t len)
+{
+	uint32_t (*t)[256] = crc32c_slice_table;
+	uint32_t lo, hi;
+
+	crc32c_slice_init();
+
+	for (; len >= 8; buf += 8, len -= 8) {
+		lo = crc ^ get_le32(buf);
+		hi = get_le32(buf + 4);
+
+		crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+		      t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+		      t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+		      t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+	}
+
+	return crc32c_table_update(crc, buf, len);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+# define HAVE_CRC32C_HW
+
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_hw_update(uint32_t crc, const uint8_t *buf, size_t len)
+{
+# ifdef __x86_64__
+	uint64_t crc64, val;
+
+	for (; len && ((uintptr_t)buf & 7); len--)
+		crc = __builtin_ia32_crc32qi(crc, *buf++);
+
+	for (crc64 = crc; len >= 8; buf += 8, len -= 8) {
+		memcpy(&val, buf, 8);
+		crc64 = __builtin_ia32_crc32di(crc64, val);
+	}
+
+	crc = crc64;
+# else
+	uint32_t val;
+
+	for (; len && ((uintptr_t)buf & 3); len--)
+		crc = __builtin_ia32_crc32qi(crc, *buf++);
+
+	for (; len >= 4; buf += 4, len -= 4) {
+		memcpy(&val, buf, 4);
+		crc = __builtin_ia32_crc32si(crc, val);
+	}
+# endif
+
+	while (len--)
+		crc = __builtin_ia32_crc32qi(crc, *buf++);
+
+	return crc;
+}
+
+static int crc32c_hw_supported(void)
+{
+	__builtin_cpu_init();
+
+	return __builtin_cpu_supports("sse4.2");
+}
+#elif defined(__aarch64__)
+# define HAVE_CRC32C_HW
+
+__attribute__((target("+crc")))
+static uint32_t crc32c_hw_update(uint32_t crc, const uint8_t *buf, size_t len)
+{
+	uint64_t val;
+
+	for (; len && ((uintptr_t)buf & 7); len--)
+		__asm__("crc32cb %w0, %w0, %w1" : "+r" (crc) : "r" (*buf++));
+
+	for (; len >= 8; buf += 8, len -= 8) {
+		memcpy(&val, buf, 8);
+		__asm__("crc32cx %w0, %w0, %x1" : "+r" (crc) : "r" (val));
+	}
+
+	while (len--)
+		__asm__("crc32cb %w0, %w0, %w1" : "+r" (crc) : "r" (*buf++));
+
+	return crc;
+}
+
+static int crc32c_hw_supported(void)
+{
+	return !!(getauxval(AT_HWCAP) & HWCAP_CRC32);
+}
+#endif
+
+static const char *const impl_names[] = {
+	[TST_CRC32C_TABLE] = "table",
+	[TST_CRC32C_SLICE8] = "slice8",
+	[TST_CRC32C_HW] = "hw",
+};
+
+static uint32_t (*crc32c_update)(uint32_t crc, const uint8_t *buf, size_t len);
+static int crc32c_impl;
+
+int tst_crc32c_set_impl(int impl)
+{
+	switch (impl) {
+	case TST_CRC32C_AUTO:
+#ifdef HAVE_CRC32C_HW
+		if (!tst_crc32c_set_impl(TST_CRC32C_HW))
+			return 0;
+#endif
+		return tst_crc32c_set_impl(TST_CRC32C_SLICE8);
+	case TST_CRC32C_TABLE:
+		crc32c_update = crc32c_table_update;
+		break;
+	case TST_CRC32C_SLICE8:
+		crc32c_update = crc32c_slice8_update;
+		break;
+	case TST_CRC32C_HW:
+#ifdef HAVE_CRC32C_HW
+		if (crc32c_hw_supported()) {
+			crc32c_update = crc32c_hw_update;
+			break;
+		}
+#endif
+		return 1;
+	default:
+		return 1;
+	}
+
+	crc32c_impl = impl;
+	return 0;
+}
+
+const char *tst_crc32c_impl_name(void)
+{
+	if (!crc32c_update)
+		tst_crc32c_set_impl(TST_CRC32C_AUTO);
+
+	return impl_names[crc32c_impl];
+}
+
+void tst_crc32c_init(struct tst_crc32c *ctx)
+{
+	ctx->crc = 0xffffffff;
+}
+
+void tst_crc32c_update(struct tst_crc32c *ctx, const void *buf, size_t len)
+{
+	if (!crc32c_update)
+		tst_crc32c_set_impl(TST_CRC32C_AUTO);
+
+	ctx->crc = crc32c_update(ctx->crc, buf, len);
+}
+
+uint32_t tst_crc32c_final(struct tst_crc32c *ctx)
+{
+	return ~ctx->crc;
+}
+
 uint32_t tst_crc32c(uint8_t *buf, size_t buf_len)
 {
-	uint32_t crc = 0xffffffff;
+	struct tst_crc32c ctx;
 
-	while (buf_len--)
-		crc = crc32c_table[(crc ^ (*buf++)) & 0xff] ^ (crc >> 8);
+	tst_crc32c_init(&ctx);
+	tst_crc32c_update(&ctx, buf, buf_len);
 
-	return ~crc;
+	return tst_crc32c_final(&ctx);
 }
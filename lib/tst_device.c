@@ -25,27 +25,40 @@
 #include <sys/stat.h>
 #include <sys/ioctl.h>
 #include <sys/mount.h>
+#include <sys/file.h>
 #include <errno.h>
 #include <unistd.h>
 #include <stdlib.h>
-#include <linux/loop.h>
 #include <stdint.h>
 #include <inttypes.h>
 #include "test.h"
 #include "safe_macros.h"
-
-#ifndef LOOP_CTL_GET_FREE
-# define LOOP_CTL_GET_FREE 0x4C82
-#endif
+#include "lapi/loop.h"
 
 #define LOOP_CONTROL_FILE "/dev/loop-control"
+#define ZRAM_CONTROL_DIR "/sys/class/zram-control"
+#define NULLB_CONFIGFS_DIR "/sys/kernel/config/nullb"
 
 #define DEV_FILE "test_dev.img"
 #define DEV_SIZE_MB 256u
+#define ATTACH_RETRIES 20
 
 static char dev_path[1024];
 static int device_acquired;
 static unsigned long prev_dev_sec_write;
+static int loop_configure_broken;
+
+enum dev_backend {
+	BACKEND_LOOP,
+	BACKEND_ZRAM,
+	BACKEND_BRD,
+	BACKEND_NULLB,
+};
+
+static enum dev_backend dev_backend;
+static int ram_dev_idx;
+static int brd_fd = -1;
+static char nullb_dir[128];
 
 static const char *dev_variants[] = {
 	"/dev/loop%i",
@@ -132,10 +145,86 @@ static int find_free_loopdev(void)
 	return 1;
 }
 
+/*
+ * Direct I/O is used by default so that the backing file is not cached twice,
+ * i.e. in the loop device and in the backing file page cache, which would
+ * distort results of I/O heavy tests. The kernel silently falls back to
+ * buffered I/O if the backing filesystem does not support it.
+ */
+static int loop_direct_io(void)
+{
+	const char *env = getenv("LTP_DEV_DIRECT_IO");
+
+	if (env && (!strcmp(env, "0") || !strcmp(env, "n")))
+		return 0;
+
+	return 1;
+}
+
+static unsigned int loop_block_size(void)
+{
+	const char *env = getenv("LTP_DEV_BLOCK_SIZE");
+	unsigned long val;
+	char *end;
+
+	if (!env)
+		return 0;
+
+	val = strtoul(env, &end, 10);
+
+	if (*end || val < 512 || val > 4096 || (val & (val - 1))) {
+		tst_resm(TWARN, "Invalid LTP_DEV_BLOCK_SIZE='%s'", env);
+		return 0;
+	}
+
+	return val;
+}
+
+static void report_loop_setup(int dev_fd, const char *dev)
+{
+	struct loop_info64 info;
+	int block_size;
+
+	if (ioctl(dev_fd, LOOP_GET_STATUS64, &info) ||
+	    ioctl(dev_fd, BLKSSZGET, &block_size))
+		return;
+
+	tst_resm(TINFO, "Loop device '%s' direct I/O %s, block size %i",
+		 dev, info.lo_flags & LO_FLAGS_DIRECT_IO ? "on" : "off",
+		 block_size);
+}
+
+/*
+ * Atomic setup available since Linux 5.8, returns -1 and sets
+ * loop_configure_broken if not supported.
+ */
+static int configure_device(int dev_fd, int file_fd, const char *file,
+			    unsigned int block_size)
+{
+	struct loop_config config;
+
+	memset(&config, 0, sizeof(config));
+	config.fd = file_fd;
+	config.block_size = block_size;
+	strncpy((char *)config.info.lo_file_name, file, LO_NAME_SIZE - 1);
+
+	if (loop_direct_io())
+		config.info.lo_flags |= LO_FLAGS_DIRECT_IO;
+
+	if (!ioctl(dev_fd, LOOP_CONFIGURE, &config))
+		return 0;
+
+	if (errno == EINVAL || errno == ENOTTY)
+		loop_configure_broken = 1;
+
+	return -1;
+}
+
 static int attach_device(const char *dev, const char *file)
 {
 	int dev_fd, file_fd;
 	struct loop_info loopinfo;
+	unsigned int block_size = loop_block_size();
 
 	dev_fd = open(dev, O_RDWR);
 	if (dev_fd < 0) {
@@ -150,11 +239,46 @@ static int attach_device(const char *dev, const char *file)
 		return 1;
 	}
 
+	if (!loop_configure_broken) {
+		if (!configure_device(dev_fd, file_fd, file, block_size))
+			goto done;
+
+		if (!loop_configure_broken) {
+			int err = errno;
+
+			close(dev_fd);
+			close(file_fd);
+
+			if (err == EBUSY) {
+				tst_resm(TINFO, "Device '%s' was taken meanwhile",
+					 dev);
+			} else {
+				tst_resm(TWARN | TERRNO,
+					 "ioctl(%s, LOOP_CONFIGURE, %s) failed",
+					 dev, file);
+			}
+
+			errno = err;
+			return 1;
+		}
+	}
+
 	if (ioctl(dev_fd, LOOP_SET_FD, file_fd) < 0) {
+		int err = errno;
+
 		close(dev_fd);
 		close(file_fd);
+
+		/* Somebody else got the device in between, let caller retry */
+		if (err == EBUSY) {
+			tst_resm(TINFO, "Device '%s' was taken meanwhile", dev);
+			errno = err;
+			return 1;
+		}
+
 		tst_resm(TWARN | TERRNO, "ioctl(%s, LOOP_SET_FD, %s) failed",
 			 dev, file);
+		errno = err;
 		return 1;
 	}
 
@@ -173,6 +297,20 @@ static int attach_device(const char *dev, const char *file)
 		return 1;
 	}
 
+	if (block_size && ioctl(dev_fd, LOOP_SET_BLOCK_SIZE, block_size)) {
+		tst_resm(TINFO | TERRNO,
+			 "ioctl(%s, LOOP_SET_BLOCK_SIZE, %u) failed",
+			 dev, block_size);
+	}
+
+	/* Since Linux 4.4, failure means backing fs does not support it */
+	if (loop_direct_io() && ioctl(dev_fd, LOOP_SET_DIRECT_IO, 1)) {
+		tst_resm(TINFO | TERRNO,
+			 "ioctl(%s, LOOP_SET_DIRECT_IO, 1) failed", dev);
+	}
+
+done:
+	report_loop_setup(dev_fd, dev);
 	close(dev_fd);
 	close(file_fd);
 	return 0;
@@ -215,10 +353,190 @@ static int detach_device(const char *dev)
 	return 1;
 }
 
+static int acquire_zram(unsigned int size)
+{
+	char path[128];
+	int idx;
+
+	if (access(ZRAM_CONTROL_DIR "/hot_add", R_OK)) {
+		tst_resm(TINFO, "zram hot_add not available (modprobe zram?)");
+		return 1;
+	}
+
+	if (FILE_SCANF(ZRAM_CONTROL_DIR "/hot_add", "%i", &idx))
+		return 1;
+
+	snprintf(path, sizeof(path), "/sys/block/zram%i/disksize", idx);
+
+	if (FILE_PRINTF(path, "%uM", size)) {
+		FILE_PRINTF(ZRAM_CONTROL_DIR "/hot_remove", "%i", idx);
+		return 1;
+	}
+
+	snprintf(dev_path, sizeof(dev_path), "/dev/zram%i", idx);
+	ram_dev_idx = idx;
+
+	return 0;
+}
+
+static int release_zram(void)
+{
+	char path[128];
+
+	snprintf(path, sizeof(path), "/sys/block/zram%i/reset", ram_dev_idx);
+
+	if (FILE_PRINTF(path, "1"))
+		return 1;
+
+	return FILE_PRINTF(ZRAM_CONTROL_DIR "/hot_remove", "%i", ram_dev_idx);
+}
+
+/*
+ * The brd devices are preallocated on module load (rd_nr, rd_size), so the
+ * device is reserved by holding an exclusive flock() on it until it's
+ * released, which keeps concurrent tests and LTP_FS_JOBS workers from picking
+ * the same one. An exclusive open() cannot be held since mkfs and mount need
+ * to open the device as well, it's only used to skip devices that are
+ * mounted or otherwise in use.
+ */
+static int acquire_brd(unsigned int size)
+{
+	uint64_t dev_size;
+	int i, fd, excl_fd;
+
+	for (i = 0; i < 16; i++) {
+		snprintf(dev_path, sizeof(dev_path), "/dev/ram%i", i);
+
+		fd = open(dev_path, O_RDWR | O_CLOEXEC);
+		if (fd < 0)
+			continue;
+
+		if (flock(fd, LOCK_EX | LOCK_NB)) {
+			close(fd);
+			continue;
+		}
+
+		excl_fd = open(dev_path, O_RDWR | O_EXCL);
+		if (excl_fd < 0) {
+			close(fd);
+			continue;
+		}
+
+		close(excl_fd);
+
+		if (!ioctl(fd, BLKGETSIZE64, &dev_size) &&
+		    dev_size/1024/1024 >= size) {
+			brd_fd = fd;
+			return 0;
+		}
+
+		close(fd);
+	}
+
+	tst_resm(TINFO, "No free brd device, load brd with rd_size >= %u",
+		 size * 1024);
+	return 1;
+}
+
+static int release_brd(void)
+{
+	int ret = close(brd_fd);
+
+	brd_fd = -1;
+
+	return ret;
+}
+
+static int nullb_attr(const char *attr, const char *val)
+{
+	char path[256];
+
+	snprintf(path, sizeof(path), "%s/%s", nullb_dir, attr);
+
+	return FILE_PRINTF(path, "%s", val);
+}
+
+static int acquire_nullb(unsigned int size)
+{
+	char buf[32], path[256];
+
+	if (access(NULLB_CONFIGFS_DIR, F_OK)) {
+		tst_resm(TINFO, "null_blk configfs not available "
+			 "(modprobe null_blk nr_devices=0?)");
+		return 1;
+	}
+
+	snprintf(nullb_dir, sizeof(nullb_dir), NULLB_CONFIGFS_DIR "/ltp_%i",
+		 getpid());
+
+	if (mkdir(nullb_dir, 0755)) {
+		tst_resm(TWARN | TERRNO, "mkdir(%s) failed", nullb_dir);
+		return 1;
+	}
+
+	snprintf(buf, sizeof(buf), "%u", size);
+	snprintf(path, sizeof(path), "%s/index", nullb_dir);
+
+	if (nullb_attr("size", buf) || nullb_attr("memory_backed", "1") ||
+	    nullb_attr("power", "1") || FILE_SCANF(path, "%i", &ram_dev_idx)) {
+		rmdir(nullb_dir);
+		return 1;
+	}
+
+	snprintf(dev_path, sizeof(dev_path), "/dev/nullb%i", ram_dev_idx);
+
+	return 0;
+}
+
+static int release_nullb(void)
+{
+	int ret = nullb_attr("power", "0");
+
+	if (rmdir(nullb_dir)) {
+		tst_resm(TWARN | TERRNO, "rmdir(%s) failed", nullb_dir);
+		return 1;
+	}
+
+	return ret;
+}
+
+/*
+ * Memory backed devices avoid the I/O to TMPDIR, which may be slow, the
+ * semantic for the test is the same as for the loop device.
+ */
+static int acquire_ram_device(const char *backend, unsigned int size)
+{
+	int ret;
+
+	if (!strcmp(backend, "zram")) {
+		dev_backend = BACKEND_ZRAM;
+		ret = acquire_zram(size);
+	} else if (!strcmp(backend, "brd")) {
+		dev_backend = BACKEND_BRD;
+		ret = acquire_brd(size);
+	} else if (!strcmp(backend, "null_blk")) {
+		dev_backend = BACKEND_NULLB;
+		ret = acquire_nullb(size);
+	} else {
+		tst_resm(TWARN, "Invalid LTP_DEV_BACKEND='%s'", backend);
+		ret = 1;
+	}
+
+	if (ret) {
+		dev_backend = BACKEND_LOOP;
+		return ret;
+	}
+
+	tst_resm(TINFO, "Using %s device '%s'", backend, dev_path);
+	device_acquired = 1;
+
+	return 0;
+}
+
 const char *tst_acquire_device__(unsigned int size)
 {
-	int fd;
-	char *dev;
+	int fd, i;
+	char *dev, *backend;
 	struct stat st;
 	unsigned int acq_dev_size;
 	uint64_t ltp_dev_size;
@@ -269,16 +587,40 @@ const char *tst_acquire_device__(unsigned int size)
 				ltp_dev_size, acq_dev_size);
 	}
 
+	backend = getenv("LTP_DEV_BACKEND");
+
+	if (backend && strcmp(backend, "loop")) {
+		if (!acquire_ram_device(backend, acq_dev_size))
+			return dev_path;
+
+		tst_resm(TINFO, "Falling back to loop device");
+	}
+
 	if (tst_fill_file(DEV_FILE, 0, 1024 * 1024, acq_dev_size)) {
 		tst_resm(TWARN | TERRNO, "Failed to create " DEV_FILE);
 		return NULL;
 	}
 
-	if (find_free_loopdev())
-		return NULL;
+	/*
+	 * The free device may be grabbed by a concurrently running test before
+	 * we manage to attach the file to it, hence the retries.
+	 */
+	for (i = 0; i < ATTACH_RETRIES; i++) {
+		if (find_free_loopdev())
+			return NULL;
 
-	if (attach_device(dev_path, DEV_FILE))
+		if (!attach_device(dev_path, DEV_FILE))
+			break;
+
+		if (errno != EBUSY)
+			return NULL;
+	}
+
+	if (i >= ATTACH_RETRIES) {
+		tst_resm(TWARN, "Failed to attach loop device in %i retries",
+			 ATTACH_RETRIES);
 		return NULL;
+	}
 
 	device_acquired = 1;
 
@@ -317,12 +659,24 @@ int tst_release_device(const char *dev)
 	if (!device_acquired)
 		return 0;
 
-	/*
-	 * Loop device was created -> we need to detach it.
-	 *
-	 * The file image is deleted in tst_rmdir();
-	 */
-	ret = detach_device(dev);
+	switch (dev_backend) {
+	case BACKEND_ZRAM:
+		ret = release_zram();
+	break;
+	case BACKEND_BRD:
+		ret = release_brd();
+	break;
+	case BACKEND_NULLB:
+		ret = release_nullb();
+	break;
+	default:
+		/*
+		 * Loop device was created -> we need to detach it.
+		 *
+		 * The file image is deleted in tst_rmdir();
+		 */
+		ret = detach_device(dev);
+	}
 
 	device_acquired = 0;
 
@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Fast filesystem fill, the bulk of the space is preallocated with
+ * fallocate() and the rest is written by a thread per CPU. Each call fills
+ * its own temporary directory so that repeated calls only add new files.
+ */
+
+#define _GNU_SOURCE
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_fs.h"
+#include "tst_cpu.h"
+#include "tst_timer.h"
+#include "tst_clocks.h"
+#include "tst_safe_pthread.h"
+
+#define MAX_WRITERS 16
+#define WRITE_BUF (1024 * 1024)
+#define MAX_FILE (64 * 1024 * 1024)
+#define MAX_PREALLOC_FILE (1024LL * 1024 * 1024)
+/* Files per directory in the inode mode */
+#define DIR_FILES 1000
+
+struct fill {
+	const char *path;
+	int mode;
+	/* Bytes or inodes left to the target */
+	int64_t left;
+	/* Bytes or inodes added by the writers */
+	uint64_t done;
+	int stop;
+	int err;
+	char *buf;
+};
+
+struct writer {
+	struct fill *fill;
+	int id;
+};
+
+static int take(struct fill *fill, int64_t n)
+{
+	if (__atomic_load_n(&fill->stop, __ATOMIC_RELAXED))
+		return 0;
+
+	return __atomic_sub_fetch(&fill->left, n, __ATOMIC_RELAXED) + n > 0;
+}
+
+/* ENOSPC ends the fill, any other error is reported by the main thread */
+static void stop(struct fill *fill, int err)
+{
+	if (err != ENOSPC)
+		__atomic_store_n(&fill->err, err, __ATOMIC_RELAXED);
+
+	__atomic_store_n(&fill->stop, 1, __ATOMIC_RELAXED);
+}
+
+static void fill_blocks(struct writer *w)
+{
+	struct fill *fill = w->fill;
+	char file[PATH_MAX];
+	ssize_t ret;
+	size_t len;
+	int i, fd;
+
+	for (i = 0; take(fill, WRITE_BUF); i++) {
+		snprintf(file, sizeof(file), "%s/fill%i_%i", fill->path, w->id, i);
+
+		fd = open(file, O_WRONLY | O_CREAT | O_EXCL, 0600);
+		if (fd < 0) {
+			stop(fill, errno);
+			return;
+		}
+
+		for (len = 0; ; len += ret) {
+			ret = write(fd, fill->buf, WRITE_BUF);
+			if (ret < 0) {
+				stop(fill, errno);
+				close(fd);
+				return;
+			}
+
+			__atomic_add_fetch(&fill->done, ret, __ATOMIC_RELAXED);
+
+			if (len + ret >= MAX_FILE || !take(fill, WRITE_BUF))
+				break;
+		}
+
+		close(fd);
+	}
+}
+
+static void fill_inodes(struct writer *w)
+{
+	struct fill *fill = w->fill;
+	char dir[PATH_MAX], file[PATH_MAX + 16];
+	int i, fd;
+
+	for (i = 0; take(fill, 1); i++) {
+		if (!(i % DIR_FILES)) {
+			snprintf(dir, sizeof(dir), "%s/fill%i_%i", fill->path,
+				 w->id, i / DIR_FILES);
+
+			if (mkdir(dir, 0700)) {
+				stop(fill, errno);
+				return;
+			}
+
+			__atomic_add_fetch(&fill->done, 1, __ATOMIC_RELAXED);
+			continue;
+		}
+
+		snprintf(file, sizeof(file), "%s/%i", dir, i);
+
+		fd = open(file, O_WRONLY | O_CREAT | O_EXCL, 0600);
+		if (fd < 0) {
+			stop(fill, errno);
+			return;
+		}
+
+		close(fd);
+		__atomic_add_fetch(&fill->done, 1, __ATOMIC_RELAXED);
+	}
+}
+
+static void *writer(void *arg)
+{
+	struct writer *w = arg;
+
+	if (w->fill->mode == TST_FILL_INODES)
+		fill_inodes(w);
+	else
+		fill_blocks(w);
+
+	return NULL;
+}
+
+/*
+ * Preallocates all but the last few percent of the space to fill, returns
+ * number of bytes allocated.
+ */
+static uint64_t prealloc(const char *path, int64_t size)
+{
+	int64_t len, margin = MAX(size / 50, 16LL * 1024 * 1024);
+	uint64_t done = 0;
+	char file[PATH_MAX];
+	struct stat st;
+	int i, fd, ret;
+
+	for (i = 0; size - margin > 0; i++) {
+		len = MIN(size - margin, MAX_PREALLOC_FILE);
+
+		snprintf(file, sizeof(file), "%s/prealloc%i", path, i);
+		fd = SAFE_OPEN(file, O_WRONLY | O_CREAT | O_EXCL, 0600);
+
+		ret = fallocate(fd, 0, 0, len);
+		if (ret && errno != EOPNOTSUPP && errno != ENOSPC)
+			tst_brk(TBROK | TERRNO, "fallocate(%s)", file);
+
+		/* A failed fallocate() may have allocated a part of the range */
+		SAFE_FSTAT(fd, &st);
+		SAFE_CLOSE(fd);
+
+		done += MIN((int64_t)st.st_blocks * 512, len);
+		size -= len;
+
+		if (ret)
+			break;
+	}
+
+	return done;
+}
+
+void tst_fill_fs_target(const char *path, unsigned int percent, int mode)
+{
+	struct writer writers[MAX_WRITERS];
+	pthread_t threads[MAX_WRITERS];
+	struct fill fill = {.mode = mode};
+	struct timespec start, end;
+	char dir[PATH_MAX / 2];
+	struct statvfs sb;
+	uint64_t total, used, preallocated = 0;
+	long long us;
+	int i, nwriters;
+
+	if (!percent || percent > 100)
+		tst_brk(TBROK, "Invalid fill target %u%%", percent);
+
+	if (statvfs(path, &sb))
+		tst_brk(TBROK | TERRNO, "statvfs(%s)", path);
+
+	if (mode == TST_FILL_INODES) {
+		total = sb.f_files;
+		used = sb.f_files - sb.f_ffree;
+	} else {
+		total = (uint64_t)sb.f_blocks * sb.f_frsize;
+		used = (uint64_t)(sb.f_blocks - sb.f_bfree) * sb.f_frsize;
+	}
+
+	if (percent == 100 || !total)
+		fill.left = INT64_MAX;
+	else
+		fill.left = (int64_t)(total / 100 * percent) - (int64_t)used;
+
+	if (fill.left <= 0) {
+		tst_res(TINFO, "%s is already filled over %u%%", path, percent);
+		return;
+	}
+
+	snprintf(dir, sizeof(dir), "%s/ltp_fill_XXXXXX", path);
+	if (!mkdtemp(dir)) {
+		if (errno == ENOSPC) {
+			tst_res(TINFO, "%s is already full", path);
+			return;
+		}
+
+		tst_brk(TBROK | TERRNO, "mkdtemp(%s)", dir);
+	}
+
+	fill.path = dir;
+
+	if (mode == TST_FILL_INODES && fill.left != INT64_MAX)
+		fill.left--;
+
+	tst_clock_gettime(CLOCK_MONOTONIC, &start);
+
+	if (mode == TST_FILL_BLOCKS) {
+		preallocated = prealloc(dir, percent == 100 ?
+			(int64_t)(sb.f_bavail * sb.f_frsize) : fill.left);
+
+		if (fill.left != INT64_MAX)
+			fill.left -= preallocated;
+
+		fill.buf = SAFE_MALLOC(WRITE_BUF);
+		for (i = 0; i < WRITE_BUF; i++)
+			fill.buf[i] = random();
+	}
+
+	nwriters = MAX(1, MIN(tst_ncpus(), MAX_WRITERS));
+
+	for (i = 0; i < nwriters; i++) {
+		writers[i].fill = &fill;
+		writers[i].id = i;
+		SAFE_PTHREAD_CREATE(&threads[i], NULL, writer, &writers[i]);
+	}
+
+	for (i = 0; i < nwriters; i++)
+		SAFE_PTHREAD_JOIN(threads[i], NULL);
+
+	tst_clock_gettime(CLOCK_MONOTONIC, &end);
+	us = MAX(tst_timespec_diff_us(end, start), 1LL);
+
+	free(fill.buf);
+
+	if (fill.err) {
+		errno = fill.err;
+		tst_brk(TBROK | TERRNO, "Filling %s failed", path);
+	}
+
+	if (mode == TST_FILL_INODES) {
+		tst_res(TINFO, "Created %llu inodes in %lli ms (%.0f inodes/s)",
+			(unsigned long long)fill.done, us / 1000,
+			fill.done * 1000000.0 / us);
+	} else {
+		tst_res(TINFO, "Filled %llu MB (%llu MB preallocated) in %lli ms "
+			"(%.1f MB/s)", (unsigned long long)(fill.done + preallocated) >> 20,
+			(unsigned long long)preallocated >> 20, us / 1000,
+			(fill.done + preallocated) / (double)us);
+	}
+}
@@ -82,6 +82,8 @@ const char *tst_fs_type_name(long f_type)
 		return "NILFS";
 	case TST_EXOFS_MAGIC:
 		return "EXOFS";
+	case TST_CGROUP2_MAGIC:
+		return "CGROUP2";
 	default:
 		return "Unknown";
 	}
@@ -0,0 +1,388 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <mntent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_clocks.h"
+#include "tst_timer.h"
+#include "tst_ftrace.h"
+
+#define MAX_EVENTS 32
+
+static char tracefs[PATH_MAX / 2];
+/* The instance or the top level tracing directory if it is used instead */
+static char dir[PATH_MAX / 2 + 64];
+static int instance;
+static int armed;
+static int use_tracer;
+static int top_lock_fd = -1;
+
+static char *spec;
+static const char *events[MAX_EVENTS];
+static unsigned int nevents;
+static const char *tracer;
+static const char *filter;
+static int slow_ms;
+static const char *out_dir;
+static unsigned int run_cnt;
+static struct timespec start_time;
+
+static int write_str(const char *file, const char *str, int append)
+{
+	char path[PATH_MAX];
+	ssize_t len = strlen(str);
+	int fd, ret = 0;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, file);
+
+	fd = open(path, O_WRONLY | (append ? O_APPEND : O_TRUNC));
+	if (fd < 0)
+		return 1;
+
+	if (len && write(fd, str, len) != len)
+		ret = 1;
+
+	close(fd);
+	return ret;
+}
+
+static int read_file(const char *path, char *buf, size_t size)
+{
+	ssize_t len;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 1;
+
+	len = read(fd, buf, size - 1);
+	close(fd);
+
+	if (len < 0)
+		return 1;
+
+	buf[len] = 0;
+	return 0;
+}
+
+static int find_tracefs(void)
+{
+	struct mntent *mnt;
+	FILE *f;
+
+	f = setmntent("/proc/self/mounts", "r");
+	if (!f)
+		return 1;
+
+	while ((mnt = getmntent(f))) {
+		if (!strcmp(mnt->mnt_type, "tracefs")) {
+			snprintf(tracefs, sizeof(tracefs), "%s", mnt->mnt_dir);
+			break;
+		}
+
+		if (!strcmp(mnt->mnt_type, "debugfs") && !tracefs[0]) {
+			snprintf(tracefs, sizeof(tracefs), "%s/tracing",
+				 mnt->mnt_dir);
+		}
+	}
+
+	endmntent(f);
+
+	return !tracefs[0] || access(tracefs, F_OK);
+}
+
+static void parse_spec(const char *env)
+{
+	char *tok, *save = NULL, *eq;
+
+	spec = strdup(env);
+	if (!spec)
+		tst_brk(TBROK | TERRNO, "strdup()");
+
+	for (tok = strtok_r(spec, ",", &save); tok;
+	     tok = strtok_r(NULL, ",", &save)) {
+		if (!strncmp(tok, "function", 8)) {
+			eq = strchr(tok, '=');
+			if (eq) {
+				*eq = 0;
+				filter = eq + 1;
+			}
+
+			tracer = tok;
+			continue;
+		}
+
+		if (nevents >= MAX_EVENTS)
+			tst_brk(TBROK, "Too many events in LTP_FTRACE");
+
+		events[nevents++] = tok;
+	}
+}
+
+int tst_ftrace_init(void)
+{
+	const char *env = getenv("LTP_FTRACE");
+	const char *slow = getenv("LTP_FTRACE_SLOW");
+
+	if (!env)
+		return 1;
+
+	if (find_tracefs()) {
+		tst_res(TINFO, "tracefs is not mounted, LTP_FTRACE ignored");
+		return 1;
+	}
+
+	if (slow && tst_parse_int(slow, &slow_ms, 0, INT_MAX))
+		tst_brk(TBROK, "Invalid LTP_FTRACE_SLOW '%s'", slow);
+
+	out_dir = getenv("LTP_FTRACE_DIR");
+	if (!out_dir)
+		out_dir = getenv("TMPDIR");
+	if (!out_dir)
+		out_dir = "/tmp";
+
+	parse_spec(env);
+
+	return 0;
+}
+
+static int tracer_available(const char *path)
+{
+	char buf[1024], *p;
+	size_t len = strlen(tracer);
+
+	if (read_file(path, buf, sizeof(buf)))
+		return 0;
+
+	for (p = buf; (p = strstr(p, tracer)); p += len) {
+		if ((p == buf || p[-1] == ' ')
+		    && (p[len] == ' ' || p[len] == '\n' || !p[len]))
+			return 1;
+	}
+
+	return 0;
+}
+
+static int top_level_idle(void)
+{
+	char path[PATH_MAX], buf[256];
+
+	snprintf(path, sizeof(path), "%s/current_tracer", tracefs);
+	if (read_file(path, buf, sizeof(buf)) || strcmp(buf, "nop\n"))
+		return 0;
+
+	snprintf(path, sizeof(path), "%s/tracing_on", tracefs);
+	if (read_file(path, buf, sizeof(buf)) || strcmp(buf, "0\n"))
+		return 0;
+
+	snprintf(path, sizeof(path), "%s/set_event", tracefs);
+	if (read_file(path, buf, sizeof(buf)) || buf[strspn(buf, " \n")])
+		return 0;
+
+	return 1;
+}
+
+/*
+ * Some tracers, e.g. function_graph, are not supported in instances, the top
+ * level buffer is used instead if nobody else is using it, i.e. no tracer,
+ * no events and tracing switched off. Concurrent tests are serialized by an
+ * flock() on the top level trace file. Returns non-zero if the tracer cannot
+ * be used.
+ */
+static int select_buffer(void)
+{
+	char path[PATH_MAX];
+
+	snprintf(path, sizeof(path), "%s/available_tracers", dir);
+	if (tracer_available(path))
+		return 0;
+
+	snprintf(path, sizeof(path), "%s/available_tracers", tracefs);
+	if (!tracer_available(path)) {
+		tst_res(TINFO, "Tracer %s is not available", tracer);
+		return 1;
+	}
+
+	snprintf(path, sizeof(path), "%s/trace", tracefs);
+	top_lock_fd = open(path, O_RDONLY | O_CLOEXEC);
+
+	if (top_lock_fd < 0 || flock(top_lock_fd, LOCK_EX | LOCK_NB)
+	    || !top_level_idle()) {
+		tst_res(TINFO, "Tracer %s is not available in instances and "
+			"the top level buffer is in use, tracing events only",
+			tracer);
+		if (top_lock_fd >= 0) {
+			close(top_lock_fd);
+			top_lock_fd = -1;
+		}
+		return 1;
+	}
+
+	tst_res(TINFO, "Tracer %s is not available in instances, using the "
+		"top level buffer", tracer);
+
+	rmdir(dir);
+	snprintf(dir, sizeof(dir), "%s", tracefs);
+	instance = 0;
+	write_str("trace", "", 0);
+
+	return 0;
+}
+
+void tst_ftrace_arm(void)
+{
+	unsigned int i;
+
+	snprintf(dir, sizeof(dir), "%s/instances/ltp_%i", tracefs, getpid());
+
+	/* Leftover from a killed run */
+	rmdir(dir);
+
+	if (mkdir(dir, 0700)) {
+		tst_res(TWARN | TERRNO, "Failed to create tracing instance %s",
+			dir);
+		return;
+	}
+
+	instance = 1;
+	use_tracer = tracer && !select_buffer();
+
+	write_str("tracing_on", "0", 0);
+	write_str("options/event-fork", "1", 0);
+	write_str("options/function-fork", "1", 0);
+
+	for (i = 0; i < nevents; i++) {
+		if (write_str("set_event", events[i], 1))
+			tst_res(TWARN | TERRNO, "Failed to enable event %s",
+				events[i]);
+	}
+
+	if (use_tracer) {
+		if (filter && write_str("set_ftrace_filter", filter, 0))
+			tst_res(TINFO | TERRNO, "Invalid function filter %s",
+				filter);
+
+		if (write_str("current_tracer", tracer, 0))
+			tst_res(TINFO | TERRNO, "Failed to set tracer %s", tracer);
+	}
+
+	armed = 1;
+}
+
+void tst_ftrace_start(pid_t pid)
+{
+	char buf[32];
+
+	if (!armed)
+		return;
+
+	snprintf(buf, sizeof(buf), "%i", pid);
+
+	if (nevents)
+		write_str("set_event_pid", buf, 0);
+
+	if (use_tracer)
+		write_str("set_ftrace_pid", buf, 0);
+
+	tst_clock_gettime(CLOCK_MONOTONIC, &start_time);
+	write_str("tracing_on", "1", 0);
+}
+
+static void save(const char *reason)
+{
+	char src[PATH_MAX], dst[PATH_MAX], buf[65536];
+	ssize_t len;
+	int in, out;
+
+	snprintf(src, sizeof(src), "%s/trace", dir);
+	snprintf(dst, sizeof(dst), "%s/ltp_ftrace_%s_%i_%u.txt", out_dir,
+		 TCID, getpid(), run_cnt);
+
+	in = open(src, O_RDONLY);
+	if (in < 0) {
+		tst_res(TWARN | TERRNO, "Failed to open %s", src);
+		return;
+	}
+
+	/* The output directory may be shared, never follow or reuse a file */
+	out = open(dst, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW, 0644);
+	if (out < 0) {
+		tst_res(TWARN | TERRNO, "Failed to create %s", dst);
+		close(in);
+		return;
+	}
+
+	while ((len = read(in, buf, sizeof(buf))) > 0) {
+		if (write(out, buf, len) != len) {
+			tst_res(TWARN | TERRNO, "Failed to write %s", dst);
+			break;
+		}
+	}
+
+	close(in);
+	close(out);
+
+	tst_res(TINFO, "Test run %s, kernel trace saved to %s", reason, dst);
+}
+
+static void disarm(void)
+{
+	write_str("current_tracer", "nop", 0);
+	write_str("set_event", "", 0);
+	write_str("set_ftrace_filter", "", 0);
+	write_str("set_event_pid", "", 0);
+	write_str("set_ftrace_pid", "", 0);
+
+	if (instance) {
+		if (rmdir(dir))
+			tst_res(TWARN | TERRNO, "Failed to remove %s", dir);
+		return;
+	}
+
+	write_str("options/event-fork", "0", 0);
+	write_str("options/function-fork", "0", 0);
+	write_str("trace", "", 0);
+
+	close(top_lock_fd);
+	top_lock_fd = -1;
+}
+
+void tst_ftrace_stop(int failed)
+{
+	struct timespec now;
+	long long elapsed_ms;
+	char reason[64];
+
+	if (!armed)
+		return;
+
+	write_str("tracing_on", "0", 0);
+
+	tst_clock_gettime(CLOCK_MONOTONIC, &now);
+	elapsed_ms = tst_timespec_diff_ms(now, start_time);
+
+	run_cnt++;
+
+	if (failed) {
+		save("failed");
+	} else if (slow_ms && elapsed_ms > slow_ms) {
+		snprintf(reason, sizeof(reason), "took %llims", elapsed_ms);
+		save(reason);
+	}
+
+	disarm();
+	armed = 0;
+}
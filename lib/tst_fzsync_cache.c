@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * Fuzzy sync calibration cache, the timing statistics gathered in the
+ * sampling phase are stored into $LTP_FZSYNC_CACHE directory and loaded by
+ * the next run of the same test on the same machine and kernel.
+ */
+
+#include <sys/utsname.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_cpu.h"
+
+#define CACHE_MAGIC "LTP fzsync cache 1"
+
+/* Lines in the first /proc/cpuinfo entry that identify the CPU model */
+static const char *const cpuinfo_keys[] = {
+	"model name",
+	"cpu model",
+	"CPU implementer",
+	"CPU variant",
+	"CPU part",
+	"cpu",
+	NULL,
+};
+
+static int is_model_key(const char *line, const char *val)
+{
+	size_t len;
+	int i;
+
+	for (i = 0; cpuinfo_keys[i]; i++) {
+		len = strlen(cpuinfo_keys[i]);
+
+		if (!strncmp(line, cpuinfo_keys[i], len)
+		    && strspn(line + len, " \t") == (size_t)(val - line) - len)
+			return 1;
+	}
+
+	return 0;
+}
+
+static void cpu_model(char *buf, size_t size)
+{
+	char line[256], *val;
+	size_t pos = 0;
+	FILE *f;
+
+	buf[0] = 0;
+
+	f = fopen("/proc/cpuinfo", "r");
+	if (!f)
+		return;
+
+	while (fgets(line, sizeof(line), f) && line[0] != '\n') {
+		val = strchr(line, ':');
+		if (!val || !is_model_key(line, val))
+			continue;
+
+		val += strspn(val + 1, " \t") + 1;
+		val[strcspn(val, "\n")] = 0;
+
+		pos += snprintf(buf + pos, size - pos, "%s%s",
+				pos ? " " : "", val);
+		if (pos >= size)
+			break;
+	}
+
+	fclose(f);
+}
+
+/* FNV-1a */
+static uint64_t hash_str(const char *str)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	while (*str) {
+		hash ^= (unsigned char)*str++;
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+/*
+ * The race site is the index of the test function being run and the number
+ * of races started in it so far, so that tests that race in more places, or
+ * race different syscalls in different tcases, get separate entries.
+ */
+int tst_fzsync_cache_site(void)
+{
+	static unsigned int last_calls = UINT_MAX, race;
+	unsigned int calls, tcase = tst_tcase_idx(&calls);
+
+	if (calls != last_calls) {
+		last_calls = calls;
+		race = 0;
+	}
+
+	return tcase * 256 + race++ % 256;
+}
+
+/*
+ * The cache entry is keyed by the test name, race site, number of
+ * participants, number of online CPUs, the CPU model and the kernel release.
+ * The key is stored in the entry as well and compared on load, the hash in
+ * the file name only keeps entries for different machines apart.
+ */
+static int cache_path(int site, int participants, char *key, size_t key_size,
+		      char *path, size_t path_size)
+{
+	const char *dir = getenv("LTP_FZSYNC_CACHE");
+	char model[128];
+	struct utsname uts;
+
+	if (!dir || !dir[0] || uname(&uts))
+		return 1;
+
+	cpu_model(model, sizeof(model));
+
+	snprintf(key, key_size, "%s %i:%i %i %li %s %s %s", TCID, site / 256,
+		 site % 256, participants, tst_ncpus(), uts.machine,
+		 uts.release, model[0] ? model : "unknown");
+
+	snprintf(path, path_size, "%s/%s-%016"PRIx64".fzsync", dir, TCID,
+		 hash_str(key));
+
+	return 0;
+}
+
+int tst_fzsync_cache_load(int site, int participants, float *vals,
+			  unsigned int nvals)
+{
+	char key[512], path[PATH_MAX], line[512];
+	unsigned int i;
+	int ret = 1;
+	FILE *f;
+
+	if (cache_path(site, participants, key, sizeof(key), path, sizeof(path)))
+		return 1;
+
+	f = fopen(path, "r");
+	if (!f)
+		return 1;
+
+	if (!fgets(line, sizeof(line), f)
+	    || strcmp(line, CACHE_MAGIC "\n"))
+		goto out;
+
+	if (!fgets(line, sizeof(line), f))
+		goto out;
+
+	line[strcspn(line, "\n")] = 0;
+	if (strcmp(line, key))
+		goto out;
+
+	if (fscanf(f, "%u", &i) != 1 || i != nvals)
+		goto out;
+
+	for (i = 0; i < nvals; i++) {
+		if (fscanf(f, "%a", &vals[i]) != 1 || !isfinite(vals[i]))
+			goto out;
+	}
+
+	tst_res(TINFO, "Loaded fzsync calibration from %s", path);
+	ret = 0;
+out:
+	fclose(f);
+	return ret;
+}
+
+void tst_fzsync_cache_store(int site, int participants, const float *vals,
+			    unsigned int nvals)
+{
+	char key[512], path[PATH_MAX], tmp[PATH_MAX + 16];
+	const char *dir = getenv("LTP_FZSYNC_CACHE");
+	unsigned int i;
+	FILE *f;
+
+	if (cache_path(site, participants, key, sizeof(key), path, sizeof(path)))
+		return;
+
+	if (mkdir(dir, 0755) && errno != EEXIST) {
+		tst_res(TWARN | TERRNO, "mkdir(%s) failed", dir);
+		return;
+	}
+
+	/* Concurrent runs must never see partially written entry */
+	snprintf(tmp, sizeof(tmp), "%s.%i", path, getpid());
+
+	f = fopen(tmp, "w");
+	if (!f) {
+		tst_res(TWARN | TERRNO, "fopen(%s) failed", tmp);
+		return;
+	}
+
+	fprintf(f, CACHE_MAGIC "\n%s\n%u\n", key, nvals);
+
+	for (i = 0; i < nvals; i++)
+		fprintf(f, "%a\n", vals[i]);
+
+	if (fclose(f) || rename(tmp, path)) {
+		tst_res(TWARN | TERRNO, "Failed to store %s", path);
+		unlink(tmp);
+		return;
+	}
+
+	tst_res(TINFO, "Stored fzsync calibration in %s", path);
+}
@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+/*
+ * CPU placement of fuzzy sync participants, the CPUs are picked based on the
+ * topology exported in /sys/devices/system/cpu/.
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_fzsync_place.h"
+
+#define SYSFS_CPU "/sys/devices/system/cpu/cpu%i/"
+
+struct cpu {
+	int cpu;
+	/* The lowest numbered CPU of the core, LLC and package id */
+	int core;
+	int llc;
+	int pkg;
+};
+
+static struct cpu *cpus;
+static int ncpus;
+
+static cpu_set_t orig_mask;
+static int cpu_sel[TST_FZSYNC_PLACEMENTS][TST_FZSYNC_PLACE_MAX];
+
+static const char *const names[] = {
+	[TST_FZSYNC_PLACE_NONE] = "none",
+	[TST_FZSYNC_PLACE_SMT] = "smt",
+	[TST_FZSYNC_PLACE_LLC] = "llc",
+	[TST_FZSYNC_PLACE_CROSS] = "cross",
+	[TST_FZSYNC_PLACE_ROTATE] = "rotate",
+};
+
+const char *tst_fzsync_place_name(int placement)
+{
+	if (placement < 0 || placement > TST_FZSYNC_PLACE_ROTATE)
+		return "???";
+
+	return names[placement];
+}
+
+int tst_fzsync_place_env(void)
+{
+	const char *env = getenv("LTP_FZSYNC_PLACEMENT");
+	int i;
+
+	if (!env)
+		return TST_FZSYNC_PLACE_NONE;
+
+	for (i = 0; i <= TST_FZSYNC_PLACE_ROTATE; i++) {
+		if (!strcmp(env, names[i]))
+			return i;
+	}
+
+	tst_brk(TBROK, "Invalid LTP_FZSYNC_PLACEMENT='%s'", env);
+	return TST_FZSYNC_PLACE_NONE;
+}
+
+/* Reads a number or the first CPU of a CPU list from dir/file */
+static int read_int(const char *dir, const char *file, int def)
+{
+	char path[256];
+	FILE *f;
+	int ret;
+
+	snprintf(path, sizeof(path), "%s%s", dir, file);
+
+	f = fopen(path, "r");
+	if (!f)
+		return def;
+
+	if (fscanf(f, "%i", &ret) != 1)
+		ret = def;
+
+	fclose(f);
+	return ret;
+}
+
+/* The highest level cache, the package if the cache topology is unknown */
+static int read_llc(int cpu, int pkg)
+{
+	char dir[64];
+	int i, level, max_level = 0, llc = -1 - pkg;
+
+	for (i = 0; ; i++) {
+		snprintf(dir, sizeof(dir), SYSFS_CPU "cache/index%i/", cpu, i);
+
+		level = read_int(dir, "level", -1);
+		if (level < 0)
+			break;
+
+		if (level > max_level) {
+			max_level = level;
+			llc = read_int(dir, "shared_cpu_list", llc);
+		}
+	}
+
+	return llc;
+}
+
+static void read_topology(void)
+{
+	char dir[64];
+	int i;
+
+	if (sched_getaffinity(0, sizeof(orig_mask), &orig_mask))
+		tst_brk(TBROK | TERRNO, "sched_getaffinity() failed");
+
+	if (!cpus) {
+		cpus = malloc(sizeof(*cpus) * CPU_SETSIZE);
+		if (!cpus)
+			tst_brk(TBROK, "malloc() failed");
+	}
+
+	ncpus = 0;
+
+	for (i = 0; i < CPU_SETSIZE; i++) {
+		if (!CPU_ISSET(i, &orig_mask))
+			continue;
+
+		snprintf(dir, sizeof(dir), SYSFS_CPU, i);
+
+		cpus[ncpus].cpu = i;
+		cpus[ncpus].core = read_int(dir,
+					    "topology/thread_siblings_list", i);
+		cpus[ncpus].pkg = read_int(dir,
+					   "topology/physical_package_id", 0);
+		cpus[ncpus].llc = read_llc(i, cpus[ncpus].pkg);
+		ncpus++;
+	}
+}
+
+static int core_used(int *sel, int n, int core)
+{
+	int i, j;
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < ncpus; j++) {
+			if (cpus[j].cpu == sel[i] && cpus[j].core == core)
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* All participants on SMT siblings of a single core */
+static int select_smt(int *sel, int n)
+{
+	int i, j, cnt;
+
+	for (i = 0; i < ncpus; i++) {
+		for (j = 0, cnt = 0; j < ncpus && cnt < n; j++) {
+			if (cpus[j].core == cpus[i].core)
+				sel[cnt++] = cpus[j].cpu;
+		}
+
+		if (cnt == n)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* Each participant on a different core sharing the last level cache */
+static int select_llc(int *sel, int n)
+{
+	int i, j, cnt;
+
+	for (i = 0; i < ncpus; i++) {
+		for (j = 0, cnt = 0; j < ncpus && cnt < n; j++) {
+			if (cpus[j].llc == cpus[i].llc
+			    && !core_used(sel, cnt, cpus[j].core))
+				sel[cnt++] = cpus[j].cpu;
+		}
+
+		if (cnt == n)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* Participants spread round robin over the packages */
+static int select_cross(int *sel, int n)
+{
+	int pkgs[TST_FZSYNC_PLACE_MAX];
+	int i, j, k, npkgs = 0, cnt = 0, added = 1;
+
+	for (i = 0; i < ncpus && npkgs < n; i++) {
+		for (j = 0; j < npkgs && pkgs[j] != cpus[i].pkg; j++)
+			;
+
+		if (j == npkgs)
+			pkgs[npkgs++] = cpus[i].pkg;
+	}
+
+	if (npkgs < 2)
+		return 1;
+
+	while (cnt < n && added) {
+		added = 0;
+
+		for (k = 0; k < npkgs && cnt < n; k++) {
+			for (i = 0; i < ncpus; i++) {
+				if (cpus[i].pkg == pkgs[k]
+				    && !core_used(sel, cnt, cpus[i].core)) {
+					sel[cnt++] = cpus[i].cpu;
+					added = 1;
+					break;
+				}
+			}
+		}
+	}
+
+	return cnt != n;
+}
+
+int tst_fzsync_place_init(int participants)
+{
+	int ret = 1 << TST_FZSYNC_PLACE_NONE;
+
+	read_topology();
+
+	if (!select_smt(cpu_sel[TST_FZSYNC_PLACE_SMT], participants))
+		ret |= 1 << TST_FZSYNC_PLACE_SMT;
+
+	if (!select_llc(cpu_sel[TST_FZSYNC_PLACE_LLC], participants))
+		ret |= 1 << TST_FZSYNC_PLACE_LLC;
+
+	if (!select_cross(cpu_sel[TST_FZSYNC_PLACE_CROSS], participants))
+		ret |= 1 << TST_FZSYNC_PLACE_CROSS;
+
+	return ret;
+}
+
+void tst_fzsync_place(int placement, int i)
+{
+	cpu_set_t mask;
+
+	if (placement == TST_FZSYNC_PLACE_NONE) {
+		mask = orig_mask;
+	} else {
+		CPU_ZERO(&mask);
+		CPU_SET(cpu_sel[placement][i], &mask);
+	}
+
+	if (sched_setaffinity(0, sizeof(mask), &mask)) {
+		tst_brk(TBROK | TERRNO, "sched_setaffinity() %s placement",
+			names[placement]);
+	}
+}
+
+int tst_fzsync_place_cpu(int placement, int i)
+{
+	if (placement == TST_FZSYNC_PLACE_NONE)
+		return -1;
+
+	return cpu_sel[placement][i];
+}
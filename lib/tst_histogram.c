@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_histogram.h"
+
+#define SUB_MASK ((1 << TST_HISTOGRAM_SUB_BITS) - 1)
+#define FILE_MAGIC "LTP histogram 1"
+
+struct tst_histogram *tst_histogram_alloc(void)
+{
+	struct tst_histogram *h = SAFE_MALLOC(sizeof(*h));
+
+	tst_histogram_reset(h);
+
+	return h;
+}
+
+void tst_histogram_free(struct tst_histogram *h)
+{
+	free(h);
+}
+
+void tst_histogram_reset(struct tst_histogram *h)
+{
+	memset(h, 0, sizeof(*h));
+}
+
+void tst_histogram_merge(struct tst_histogram *dst,
+			 const struct tst_histogram *src)
+{
+	unsigned int i;
+
+	if (!src->count)
+		return;
+
+	if (!dst->count || src->min < dst->min)
+		dst->min = src->min;
+
+	if (!dst->count || src->max > dst->max)
+		dst->max = src->max;
+
+	dst->count += src->count;
+	dst->sum += src->sum;
+
+	for (i = 0; i < TST_HISTOGRAM_BUCKETS; i++)
+		dst->buckets[i] += src->buckets[i];
+}
+
+long long tst_histogram_bucket_low(unsigned int idx)
+{
+	unsigned int octave = idx >> TST_HISTOGRAM_SUB_BITS;
+
+	if (!octave)
+		return idx;
+
+	return (long long)((1 << TST_HISTOGRAM_SUB_BITS) + (idx & SUB_MASK))
+		<< (octave - 1);
+}
+
+long long tst_histogram_bucket_width(unsigned int idx)
+{
+	unsigned int octave = idx >> TST_HISTOGRAM_SUB_BITS;
+
+	return octave ? 1LL << (octave - 1) : 1;
+}
+
+long long tst_histogram_bucket_value(const struct tst_histogram *h,
+				     unsigned int idx)
+{
+	long long val;
+
+	val = tst_histogram_bucket_low(idx) +
+	      (tst_histogram_bucket_width(idx) - 1) / 2;
+
+	return MIN(MAX(val, h->min), h->max);
+}
+
+long long tst_histogram_percentile(const struct tst_histogram *h,
+				   double percent)
+{
+	uint64_t seen = 0, rank;
+	double exact;
+	unsigned int i;
+
+	if (!h->count)
+		return 0;
+
+	if (percent >= 100)
+		return h->max;
+
+	/* Nearest rank, i.e. ceil() without linking with -lm */
+	exact = percent * h->count / 100;
+	rank = exact;
+	if (rank < exact)
+		rank++;
+
+	rank = MIN(MAX(rank, 1ULL), (uint64_t)h->count);
+
+	for (i = 0; i < TST_HISTOGRAM_BUCKETS; i++) {
+		seen += h->buckets[i];
+
+		if (seen >= rank)
+			return tst_histogram_bucket_value(h, i);
+	}
+
+	return h->max;
+}
+
+long long tst_histogram_sum_top(const struct tst_histogram *h, uint64_t n)
+{
+	long long sum = 0;
+	uint64_t cnt;
+	int i;
+
+	if (n >= h->count)
+		return h->sum;
+
+	for (i = TST_HISTOGRAM_BUCKETS - 1; i >= 0 && n; i--) {
+		cnt = MIN(n, h->buckets[i]);
+		sum += cnt * tst_histogram_bucket_value(h, i);
+		n -= cnt;
+	}
+
+	return sum;
+}
+
+void tst_histogram_write(const struct tst_histogram *h, FILE *f)
+{
+	unsigned int i;
+
+	fprintf(f, "%s %i %i\n", FILE_MAGIC, TST_HISTOGRAM_SUB_BITS,
+		TST_HISTOGRAM_MAX_BITS);
+	fprintf(f, "%llu %lli %lli %lli\n", (unsigned long long)h->count,
+		h->min, h->max, h->sum);
+
+	for (i = 0; i < TST_HISTOGRAM_BUCKETS; i++) {
+		if (h->buckets[i])
+			fprintf(f, "%u %llu\n", i, (unsigned long long)h->buckets[i]);
+	}
+}
+
+int tst_histogram_read(struct tst_histogram *h, FILE *f)
+{
+	unsigned long long count, total = 0;
+	int sub_bits, max_bits;
+	unsigned int i;
+
+	tst_histogram_reset(h);
+
+	if (fscanf(f, FILE_MAGIC " %i %i", &sub_bits, &max_bits) != 2
+	    || sub_bits != TST_HISTOGRAM_SUB_BITS
+	    || max_bits != TST_HISTOGRAM_MAX_BITS)
+		goto err;
+
+	if (fscanf(f, "%llu %lli %lli %lli", &count, &h->min, &h->max,
+		   &h->sum) != 4)
+		goto err;
+
+	while (fscanf(f, "%u %llu", &i, &count) == 2) {
+		if (i >= TST_HISTOGRAM_BUCKETS)
+			goto err;
+
+		h->buckets[i] += count;
+		total += count;
+	}
+
+	if (!feof(f))
+		goto err;
+
+	h->count = total;
+	return 0;
+err:
+	tst_histogram_reset(h);
+	return 1;
+}
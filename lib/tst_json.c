@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_clocks.h"
+#include "tst_timer.h"
+#include "tst_json.h"
+
+#define BUF_SIZE (64 * 1024)
+#define REC_MAX 2048
+
+static int json_fd = -1;
+static char buf[BUF_SIZE];
+static size_t buf_len;
+static char buf_lock;
+
+static void reset_child(void)
+{
+	buf_len = 0;
+	__atomic_clear(&buf_lock, __ATOMIC_RELEASE);
+}
+
+static void write_all(const char *data, size_t len)
+{
+	size_t off = 0;
+	ssize_t ret;
+
+	while (off < len) {
+		ret = write(json_fd, data + off, len - off);
+
+		if (ret <= 0)
+			break;
+
+		off += ret;
+	}
+}
+
+void tst_json_flush(void)
+{
+	if (__atomic_test_and_set(&buf_lock, __ATOMIC_ACQUIRE))
+		return;
+
+	write_all(buf, buf_len);
+	buf_len = 0;
+
+	__atomic_clear(&buf_lock, __ATOMIC_RELEASE);
+}
+
+void tst_json_init(void)
+{
+	const char *path = getenv("LTP_JSON_OUTPUT");
+
+	if (!path || json_fd >= 0)
+		return;
+
+	json_fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (json_fd < 0)
+		tst_brk(TBROK | TERRNO, "open(%s)", path);
+
+	pthread_atfork(NULL, NULL, reset_child);
+	atexit(tst_json_flush);
+}
+
+int tst_json_enabled(void)
+{
+	return json_fd >= 0;
+}
+
+unsigned long long tst_json_ts(void)
+{
+	struct timespec ts;
+
+	tst_clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return tst_timespec_to_ns(ts);
+}
+
+/*
+ * The buffer is never waited for, if it's in use by another thread or by the
+ * code we interrupted from a signal handler the record is written directly.
+ */
+static void append(const char *rec, size_t len)
+{
+	if (__atomic_test_and_set(&buf_lock, __ATOMIC_ACQUIRE)) {
+		write_all(rec, len);
+		return;
+	}
+
+	if (buf_len + len > sizeof(buf)) {
+		write_all(buf, buf_len);
+		buf_len = 0;
+	}
+
+	memcpy(buf + buf_len, rec, len);
+	buf_len += len;
+
+	__atomic_clear(&buf_lock, __ATOMIC_RELEASE);
+}
+
+static void vevent(const char *type, const char *fmt, va_list va)
+{
+	char rec[REC_MAX];
+	int len, ret;
+
+	len = snprintf(rec, sizeof(rec), "{\"ts\":%llu,\"pid\":%i,\"type\":\"%s\",",
+		       tst_json_ts(), getpid(), type);
+
+	ret = vsnprintf(rec + len, sizeof(rec) - len - 2, fmt, va);
+	len += MIN(ret, (int)sizeof(rec) - len - 3);
+
+	rec[len++] = '}';
+	rec[len++] = '\n';
+
+	append(rec, len);
+}
+
+void tst_json_event(const char *type, const char *fmt, ...)
+{
+	va_list va;
+
+	if (json_fd < 0)
+		return;
+
+	va_start(va, fmt);
+	vevent(type, fmt, va);
+	va_end(va);
+}
+
+static void escape(char *dst, size_t size, const char *src)
+{
+	size_t len = 0;
+
+	for (; *src && len + 7 < size; src++) {
+		unsigned char c = *src;
+
+		if (c == '"' || c == '\\') {
+			dst[len++] = '\\';
+			dst[len++] = c;
+		} else if (c < 0x20) {
+			if (c == '\n' && !src[1])
+				break;
+
+			len += sprintf(dst + len, "\\u%04x", c);
+		} else {
+			dst[len++] = c;
+		}
+	}
+
+	dst[len] = 0;
+}
+
+void tst_json_res(const char *file, int lineno, const char *res,
+		  const char *msg)
+{
+	char esc_msg[REC_MAX / 2], esc_file[256];
+
+	if (json_fd < 0)
+		return;
+
+	escape(esc_msg, sizeof(esc_msg), msg);
+	escape(esc_file, sizeof(esc_file), file);
+
+	tst_json_event("result", "\"res\":\"%s\",\"file\":\"%s\",\"line\":%i,"
+		       "\"msg\":\"%s\"", res, esc_file, lineno, esc_msg);
+}
+
+void tst_json_phase(const char *phase, int tcase, unsigned long long start)
+{
+	unsigned long long end;
+
+	if (json_fd < 0)
+		return;
+
+	end = tst_json_ts();
+
+	if (tcase >= 0) {
+		tst_json_event("phase", "\"phase\":\"%s\",\"tcase\":%i,"
+			       "\"start\":%llu,\"end\":%llu", phase, tcase,
+			       start, end);
+	} else {
+		tst_json_event("phase", "\"phase\":\"%s\",\"start\":%llu,"
+			       "\"end\":%llu", phase, start, end);
+	}
+
+	tst_json_flush();
+}
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_kstat.h"
+
+#define DEFAULT_REPORT 20
+#define INIT_BUF_SIZE (64 * 1024)
+
+struct kstat_val {
+	char name[64];
+	long long val;
+};
+
+struct kstat_vals {
+	struct kstat_val *vals;
+	unsigned int cnt;
+	unsigned int size;
+};
+
+struct kstat_file {
+	const char *path;
+	const char *prefix;
+	void (*parse)(const char *prefix, char *buf, struct kstat_vals *vals);
+	char *buf[2];
+	size_t size;
+	ssize_t len[2];
+};
+
+static void add_val(struct kstat_vals *vals, const char *prefix,
+		    const char *name, long long val)
+{
+	struct kstat_val *v;
+
+	if (vals->cnt >= vals->size) {
+		vals->size = MAX(256u, 2 * vals->size);
+		vals->vals = realloc(vals->vals, vals->size * sizeof(*v));
+		if (!vals->vals)
+			tst_brk(TBROK | TERRNO, "realloc() failed");
+	}
+
+	v = &vals->vals[vals->cnt++];
+
+	if (prefix)
+		snprintf(v->name, sizeof(v->name), "%s.%s", prefix, name);
+	else
+		snprintf(v->name, sizeof(v->name), "%s", name);
+
+	v->val = val;
+}
+
+/* "name value" per line */
+static void parse_vmstat(const char *prefix, char *buf,
+			 struct kstat_vals *vals)
+{
+	char *line, *save = NULL, name[64];
+	long long val;
+
+	for (line = strtok_r(buf, "\n", &save); line;
+	     line = strtok_r(NULL, "\n", &save)) {
+		if (sscanf(line, "%63s %lli", name, &val) == 2)
+			add_val(vals, prefix, name, val);
+	}
+}
+
+/* "some avg10=0.00 avg60=0.00 avg300=0.00 total=0" */
+static void parse_pressure(const char *prefix, char *buf,
+			   struct kstat_vals *vals)
+{
+	char *line, *save = NULL, *total, name[16];
+	long long val;
+
+	for (line = strtok_r(buf, "\n", &save); line;
+	     line = strtok_r(NULL, "\n", &save)) {
+		total = strstr(line, "total=");
+
+		if (!total || sscanf(line, "%15s", name) != 1)
+			continue;
+
+		val = atoll(total + 6);
+		add_val(vals, prefix, name, val);
+	}
+}
+
+static const char *const schedstat_cpu_fields[] = {
+	"yld_count", "legacy", "sched_count", "sched_goidle", "ttwu_count",
+	"ttwu_local", "rq_cpu_time", "rq_run_delay", "rq_pcount",
+};
+
+/* "cpuN f0 f1 ...", the per-cpu values are summed */
+static void parse_schedstat(const char *prefix, char *buf,
+			    struct kstat_vals *vals)
+{
+	long long sums[ARRAY_SIZE(schedstat_cpu_fields)] = {};
+	char *line, *save = NULL, *p, *end;
+	unsigned int i;
+
+	for (line = strtok_r(buf, "\n", &save); line;
+	     line = strtok_r(NULL, "\n", &save)) {
+		if (strncmp(line, "cpu", 3))
+			continue;
+
+		p = strchr(line, ' ');
+
+		for (i = 0; p && i < ARRAY_SIZE(sums); i++) {
+			sums[i] += strtoll(p, &end, 10);
+
+			if (end == p)
+				break;
+
+			p = end;
+		}
+	}
+
+	for (i = 0; i < ARRAY_SIZE(sums); i++)
+		add_val(vals, prefix, schedstat_cpu_fields[i], sums[i]);
+}
+
+/* "IRQ: cnt0 cnt1 ... description", the per-cpu values are summed */
+static void parse_interrupts(const char *prefix, char *buf,
+			     struct kstat_vals *vals)
+{
+	char *line, *save = NULL, *p, *end, *colon;
+	long long sum, val;
+
+	for (line = strtok_r(buf, "\n", &save); line;
+	     line = strtok_r(NULL, "\n", &save)) {
+		colon = strchr(line, ':');
+
+		if (!colon)
+			continue;
+
+		*colon = 0;
+		while (*line == ' ')
+			line++;
+
+		sum = 0;
+		for (p = colon + 1; ; p = end) {
+			val = strtoll(p, &end, 10);
+
+			if (end == p)
+				break;
+
+			sum += val;
+		}
+
+		add_val(vals, prefix, line, sum);
+	}
+}
+
+static struct kstat_file files[] = {
+	{"/proc/vmstat", "vmstat", parse_vmstat, {NULL, NULL}, 0, {-1, -1}},
+	{"/proc/schedstat", "schedstat", parse_schedstat, {NULL, NULL}, 0,
+	 {-1, -1}},
+	{"/proc/pressure/cpu", "psi.cpu", parse_pressure, {NULL, NULL}, 0,
+	 {-1, -1}},
+	{"/proc/pressure/memory", "psi.memory", parse_pressure, {NULL, NULL},
+	 0, {-1, -1}},
+	{"/proc/pressure/io", "psi.io", parse_pressure, {NULL, NULL}, 0,
+	 {-1, -1}},
+	{"/proc/interrupts", "irq", parse_interrupts, {NULL, NULL}, 0,
+	 {-1, -1}},
+};
+
+unsigned int tst_kstat_enabled(void)
+{
+	const char *env = getenv("LTP_KSTAT");
+	int cnt;
+
+	if (!env)
+		return 0;
+
+	if (tst_parse_int(env, &cnt, 0, INT_MAX))
+		return DEFAULT_REPORT;
+
+	return cnt;
+}
+
+static ssize_t read_file(int fd, char *buf, size_t size)
+{
+	ssize_t ret, len = 0;
+
+	while ((size_t)len < size - 1) {
+		ret = read(fd, buf + len, size - 1 - len);
+
+		if (ret <= 0)
+			break;
+
+		len += ret;
+	}
+
+	buf[len] = 0;
+
+	return len;
+}
+
+static void snapshot_file(struct kstat_file *file, int after)
+{
+	int fd;
+
+	file->len[after] = -1;
+
+	fd = open(file->path, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	if (!file->size) {
+		file->size = INIT_BUF_SIZE;
+		file->buf[0] = SAFE_MALLOC(file->size);
+		file->buf[1] = SAFE_MALLOC(file->size);
+	}
+
+	/* The buffers are grown only before the test run */
+	for (;;) {
+		file->len[after] = read_file(fd, file->buf[after], file->size);
+
+		if (after || (size_t)file->len[after] < file->size - 1)
+			break;
+
+		file->size *= 2;
+		file->buf[0] = realloc(file->buf[0], file->size);
+		file->buf[1] = realloc(file->buf[1], file->size);
+
+		if (!file->buf[0] || !file->buf[1])
+			tst_brk(TBROK | TERRNO, "realloc() failed");
+
+		lseek(fd, 0, SEEK_SET);
+	}
+
+	close(fd);
+}
+
+void tst_kstat_snapshot(int after)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(files); i++)
+		snapshot_file(&files[i], after);
+}
+
+static long long abs_delta(const struct kstat_val *v)
+{
+	return v->val < 0 ? -v->val : v->val;
+}
+
+static int cmp_delta(const void *a, const void *b)
+{
+	long long da = abs_delta(a), db = abs_delta(b);
+
+	return (da < db) - (da > db);
+}
+
+static struct kstat_val *find_val(struct kstat_vals *vals, unsigned int hint,
+				  const char *name)
+{
+	unsigned int i;
+
+	/* The order is the same for both snapshots unless something changed */
+	if (hint < vals->cnt && !strcmp(vals->vals[hint].name, name))
+		return &vals->vals[hint];
+
+	for (i = 0; i < vals->cnt; i++) {
+		if (!strcmp(vals->vals[i].name, name))
+			return &vals->vals[i];
+	}
+
+	return NULL;
+}
+
+void tst_kstat_report(void)
+{
+	struct kstat_vals before = {}, after = {}, deltas = {};
+	struct kstat_val *v;
+	unsigned int i, report = tst_kstat_enabled();
+
+	for (i = 0; i < ARRAY_SIZE(files); i++) {
+		if (files[i].len[0] < 0 || files[i].len[1] < 0)
+			continue;
+
+		files[i].parse(files[i].prefix, files[i].buf[0], &before);
+		files[i].parse(files[i].prefix, files[i].buf[1], &after);
+	}
+
+	for (i = 0; i < after.cnt; i++) {
+		v = find_val(&before, i, after.vals[i].name);
+
+		if (!v || v->val == after.vals[i].val)
+			continue;
+
+		add_val(&deltas, NULL, after.vals[i].name,
+			after.vals[i].val - v->val);
+	}
+
+	qsort(deltas.vals, deltas.cnt, sizeof(*deltas.vals), cmp_delta);
+
+	tst_res(TINFO, "%u kernel counters changed during the test run",
+		deltas.cnt);
+
+	for (i = 0; i < MIN(deltas.cnt, report); i++) {
+		tst_res(TINFO, "%-40s %+lli", deltas.vals[i].name,
+			deltas.vals[i].val);
+	}
+
+	free(before.vals);
+	free(after.vals);
+	free(deltas.vals);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_log_ring.h"
+
+#define DEFAULT_SLOTS 1024
+#define MSG_SIZE 1024
+
+struct slot {
+	unsigned int seq;
+	unsigned int len;
+	char msg[MSG_SIZE];
+};
+
+struct ring {
+	unsigned int head;
+	unsigned int tail;
+	unsigned int size;
+	struct slot slots[];
+};
+
+static struct ring *ring;
+static int producer;
+
+int tst_log_ring_init(void)
+{
+	const char *env = getenv("LTP_LOG_RING");
+	size_t map_size;
+	int i, size;
+
+	if (ring)
+		return 1;
+
+	if (!env)
+		return 0;
+
+	if (tst_parse_int(env, &size, 2, INT_MAX / 2))
+		size = DEFAULT_SLOTS;
+
+	map_size = sizeof(*ring) + size * sizeof(struct slot);
+
+	ring = SAFE_MMAP(NULL, map_size, PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	ring->size = size;
+
+	for (i = 0; i < size; i++)
+		ring->slots[i].seq = i;
+
+	return 1;
+}
+
+void tst_log_ring_producer(void)
+{
+	producer = !!ring;
+}
+
+int tst_log_ring_put(const char *msg)
+{
+	size_t len = strlen(msg);
+	unsigned int pos, seq;
+	struct slot *slot;
+
+	if (!producer || len > MSG_SIZE)
+		return 0;
+
+	pos = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+
+	for (;;) {
+		slot = &ring->slots[pos % ring->size];
+		seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+		if (seq == pos) {
+			if (__atomic_compare_exchange_n(&ring->head, &pos,
+							pos + 1, 1,
+							__ATOMIC_RELAXED,
+							__ATOMIC_RELAXED))
+				break;
+		} else if ((int)(seq - pos) < 0) {
+			return 0;
+		} else {
+			pos = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+		}
+	}
+
+	memcpy(slot->msg, msg, len);
+	slot->len = len;
+	__atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+
+	return 1;
+}
+
+void tst_log_ring_drain(int final)
+{
+	unsigned int pos, lost = 0;
+	struct slot *slot;
+
+	if (!ring || producer)
+		return;
+
+	for (;;) {
+		pos = ring->tail;
+		slot = &ring->slots[pos % ring->size];
+
+		if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) == pos + 1)
+			fwrite(slot->msg, slot->len, 1, stderr);
+		else if (final && pos != __atomic_load_n(&ring->head, __ATOMIC_RELAXED))
+			lost++;
+		else
+			break;
+
+		__atomic_store_n(&slot->seq, pos + ring->size, __ATOMIC_RELEASE);
+		ring->tail = pos + 1;
+	}
+
+	if (lost) {
+		tst_res(TINFO, "%u messages lost, producers killed while writing",
+			lost);
+	}
+}
@@ -15,12 +15,327 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <sys/mount.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <inttypes.h>
 #include "test.h"
 #include "ltp_priv.h"
 #include "tst_mkfs.h"
 #include "tst_device.h"
+#include "lapi/fs.h"
+#include "lapi/seek.h"
 
 #define OPTS_MAX 32
+#define CACHE_CHUNK (64 * 1024)
+
+static int find_in_path(const char *name, char *buf, size_t size)
+{
+	char *path = getenv("PATH");
+	char *dirs, *dir, *save = NULL;
+	int ret = 1;
+
+	if (!path)
+		return 1;
+
+	dirs = strdup(path);
+	if (!dirs)
+		return 1;
+
+	for (dir = strtok_r(dirs, ":", &save); dir;
+	     dir = strtok_r(NULL, ":", &save)) {
+		snprintf(buf, size, "%s/%s", dir, name);
+
+		if (!access(buf, X_OK)) {
+			ret = 0;
+			break;
+		}
+	}
+
+	free(dirs);
+	return ret;
+}
+
+static uint64_t get_dev_size(int fd)
+{
+	struct stat st;
+	uint64_t size;
+
+	if (fstat(fd, &st))
+		return 0;
+
+	if (S_ISREG(st.st_mode))
+		return st.st_size;
+
+	if (ioctl(fd, BLKGETSIZE64, &size))
+		return 0;
+
+	return size;
+}
+
+/* FNV-1a, the terminating null byte is hashed as a separator */
+static uint64_t hash_str(uint64_t hash, const char *str)
+{
+	do {
+		hash ^= (unsigned char)*str;
+		hash *= 0x100000001b3ULL;
+	} while (*str++);
+
+	return hash;
+}
+
+/*
+ * The cached image name is a hash of everything that affects the mkfs result,
+ * i.e. filesystem type, device size, mkfs options and mkfs binary, where size
+ * and modification time of the binary stand for the mkfs version.
+ */
+static int cache_img_path(char *path, size_t size, const char *cache_dir,
+			  const char *const argv[], const char *fs_type,
+			  const char *dev)
+{
+	char bin[PATH_MAX], buf[PATH_MAX + 128];
+	uint64_t hash = 0xcbf29ce484222325ULL, dev_size;
+	struct stat st;
+	int i, fd;
+
+	if (find_in_path(argv[0], bin, sizeof(bin)) || stat(bin, &st))
+		return 1;
+
+	fd = open(dev, O_RDONLY);
+	if (fd < 0)
+		return 1;
+
+	dev_size = get_dev_size(fd);
+	close(fd);
+
+	if (!dev_size)
+		return 1;
+
+	snprintf(buf, sizeof(buf), "%s %lld %lld %"PRIu64, bin,
+		 (long long)st.st_size, (long long)st.st_mtime, dev_size);
+
+	hash = hash_str(hash, buf);
+
+	for (i = 1; argv[i]; i++) {
+		if (argv[i] == dev)
+			hash = hash_str(hash, "$DEV");
+		else
+			hash = hash_str(hash, argv[i]);
+	}
+
+	snprintf(path, size, "%s/%s-%016"PRIx64".img", cache_dir, fs_type, hash);
+
+	return 0;
+}
+
+static int copy_range(int src_fd, int dst_fd, char *buf, off_t off, off_t end)
+{
+	ssize_t ret;
+	size_t len;
+
+	while (off < end) {
+		len = MIN((off_t)CACHE_CHUNK, end - off);
+
+		ret = pread(src_fd, buf, len, off);
+		if (ret <= 0)
+			return 1;
+
+		if (pwrite(dst_fd, buf, ret, off) != ret)
+			return 1;
+
+		off += ret;
+	}
+
+	return 0;
+}
+
+/*
+ * The device is zeroed first, which is cheap for devices that support it
+ * (loop devices punch a hole in the backing file), then the data extents of
+ * the sparse image are written over it.
+ */
+static int cache_restore(const char *img, const char *dev)
+{
+	int img_fd, dev_fd, ret = 1;
+	uint64_t range[2] = {0, 0};
+	off_t off, end, size;
+	char *buf = NULL;
+
+	img_fd = open(img, O_RDONLY);
+	if (img_fd < 0)
+		return 1;
+
+	dev_fd = open(dev, O_WRONLY);
+	if (dev_fd < 0)
+		goto out_img;
+
+	size = get_dev_size(dev_fd);
+	range[1] = size;
+
+	if (!size || ioctl(dev_fd, BLKZEROOUT, range)) {
+		tst_resm(TINFO | TERRNO, "Cannot zero %s, not using cache", dev);
+		goto out;
+	}
+
+	buf = malloc(CACHE_CHUNK);
+	if (!buf)
+		goto out;
+
+	for (off = 0; off < size; off = end) {
+		off = lseek(img_fd, off, SEEK_DATA);
+		if (off < 0) {
+			if (errno == ENXIO)
+				break;
+			/* SEEK_DATA not supported, copy everything */
+			off = 0;
+			end = size;
+		} else {
+			end = lseek(img_fd, off, SEEK_HOLE);
+			if (end < 0)
+				end = size;
+		}
+
+		if (copy_range(img_fd, dev_fd, buf, off, end))
+			goto out;
+	}
+
+	ret = fsync(dev_fd);
+out:
+	free(buf);
+	close(dev_fd);
+out_img:
+	close(img_fd);
+	return ret;
+}
+
+/*
+ * A restored image keeps the UUID of the cached one, which makes XFS refuse
+ * to mount a second device restored from the same image and btrfs to treat
+ * them as devices of one filesystem.
+ */
+static const struct uuid_cmd {
+	const char *fs_type;
+	const char *argv[5];
+} uuid_cmds[] = {
+	{"ext2", {"tune2fs", "-U", "random", NULL}},
+	{"ext3", {"tune2fs", "-U", "random", NULL}},
+	{"ext4", {"tune2fs", "-U", "random", NULL}},
+	{"xfs", {"xfs_admin", "-U", "generate", NULL}},
+	{"btrfs", {"btrfstune", "-f", "-u", NULL}},
+};
+
+/*
+ * Filesystems without UUID or where duplicates do not matter are restored as
+ * they are, for the rest the cache is used only if the UUID can be changed.
+ */
+static int new_uuid(const char *fs_type, const char *dev)
+{
+	const char *argv[6];
+	unsigned int i, j;
+
+	for (i = 0; i < ARRAY_SIZE(uuid_cmds); i++) {
+		if (!strcmp(uuid_cmds[i].fs_type, fs_type))
+			break;
+	}
+
+	if (i >= ARRAY_SIZE(uuid_cmds))
+		return 0;
+
+	for (j = 0; uuid_cmds[i].argv[j]; j++)
+		argv[j] = uuid_cmds[i].argv[j];
+
+	argv[j++] = dev;
+	argv[j] = NULL;
+
+	if (tst_run_cmd(NULL, argv, "/dev/null", "/dev/null", 1)) {
+		tst_resm(TINFO, "%s failed, not using cache", argv[0]);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int is_zero(const char *buf, size_t len)
+{
+	return !buf[0] && !memcmp(buf, buf + 1, len - 1);
+}
+
+/*
+ * Stores the freshly formatted device as a sparse image, the image is written
+ * into a temporary file first and renamed so that concurrent tests never see
+ * partially written image.
+ */
+static void cache_store(const char *cache_dir, const char *img,
+			const char *dev)
+{
+	char tmp[PATH_MAX + 16];
+	int img_fd, dev_fd = -1;
+	off_t off, size;
+	ssize_t ret;
+	char *buf = NULL;
+
+	if (mkdir(cache_dir, 0755) && errno != EEXIST) {
+		tst_resm(TINFO | TERRNO, "mkdir(%s) failed", cache_dir);
+		return;
+	}
+
+	snprintf(tmp, sizeof(tmp), "%s.%i", img, getpid());
+
+	img_fd = open(tmp, O_CREAT | O_EXCL | O_WRONLY, 0644);
+	if (img_fd < 0) {
+		tst_resm(TINFO | TERRNO, "open(%s) failed", tmp);
+		return;
+	}
+
+	dev_fd = open(dev, O_RDONLY);
+	if (dev_fd < 0)
+		goto err;
+
+	size = get_dev_size(dev_fd);
+	buf = malloc(CACHE_CHUNK);
+
+	if (!size || !buf || ftruncate(img_fd, size))
+		goto err;
+
+	for (off = 0; off < size; off += ret) {
+		ret = pread(dev_fd, buf, CACHE_CHUNK, off);
+		if (ret <= 0)
+			goto err;
+
+		if (is_zero(buf, ret))
+			continue;
+
+		if (pwrite(img_fd, buf, ret, off) != ret)
+			goto err;
+	}
+
+	if (close(img_fd)) {
+		img_fd = -1;
+		goto err;
+	}
+
+	if (rename(tmp, img)) {
+		img_fd = -1;
+		goto err;
+	}
+
+	tst_resm(TINFO, "Stored %s image in %s", dev, img);
+	free(buf);
+	close(dev_fd);
+	return;
+err:
+	tst_resm(TINFO | TERRNO, "Failed to store %s image in %s", dev, img);
+	free(buf);
+	if (dev_fd >= 0)
+		close(dev_fd);
+	if (img_fd >= 0)
+		close(img_fd);
+	unlink(tmp);
+}
 
 void tst_mkfs_(const char *file, const int lineno, void (cleanup_fn)(void),
 	       const char *dev, const char *fs_type,
@@ -31,6 +346,8 @@ void tst_mkfs_(const char *file, const int lineno, void (cleanup_fn)(void),
 	const char *argv[OPTS_MAX] = {mkfs};
 	char fs_opts_str[1024] = "";
 	char extra_opts_str[1024] = "";
+	char img[PATH_MAX];
+	const char *cache_dir;
 
 	if (!dev) {
 		tst_brkm(TBROK, cleanup_fn,
@@ -83,6 +400,18 @@ void tst_mkfs_(const char *file, const int lineno, void (cleanup_fn)(void),
 
 	argv[pos] = NULL;
 
+	cache_dir = getenv("LTP_MKFS_CACHE");
+	if (cache_dir && cache_img_path(img, sizeof(img), cache_dir,
+					argv, fs_type, dev))
+		cache_dir = NULL;
+
+	if (cache_dir && !cache_restore(img, dev) && !new_uuid(fs_type, dev)) {
+		tst_resm(TINFO, "Restored %s with %s opts='%s' extra opts='%s' "
+			 "from %s", dev, fs_type, fs_opts_str, extra_opts_str,
+			 img);
+		return;
+	}
+
 	if (tst_clear_device(dev))
 		tst_brkm(TBROK, cleanup_fn, "tst_clear_device() failed");
 
@@ -100,6 +429,9 @@ void tst_mkfs_(const char *file, const int lineno, void (cleanup_fn)(void),
 		tst_brkm(TBROK, cleanup_fn,
 			 "%s:%d: %s failed with %i", mkfs, ret, file, lineno);
 	}
+
+	if (cache_dir)
+		cache_store(cache_dir, img, dev);
 }
 
 const char *tst_dev_fs_type(void)
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "config.h"
+#ifdef HAVE_PERF_EVENT_ATTR
+# include <linux/perf_event.h>
+#endif
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "lapi/syscalls.h"
+#include "tst_perf.h"
+
+int tst_perf_enabled(void)
+{
+	return getenv("LTP_PERF_COUNTERS") || getenv("LTP_PERF_OUTPUT");
+}
+
+#ifdef HAVE_PERF_EVENT_ATTR
+
+struct perf_counter {
+	const char *name;
+	uint32_t type;
+	uint64_t config;
+	int fd;
+	unsigned long long val;
+};
+
+static struct perf_counter counters[] = {
+	{"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1, 0},
+	{"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1, 0},
+	{"task-clock", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, -1, 0},
+	{"context-switches", PERF_TYPE_SOFTWARE,
+	 PERF_COUNT_SW_CONTEXT_SWITCHES, -1, 0},
+	{"cpu-migrations", PERF_TYPE_SOFTWARE,
+	 PERF_COUNT_SW_CPU_MIGRATIONS, -1, 0},
+	{"page-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, -1, 0},
+};
+
+/* Set if any counter could be opened only without kernel space */
+static int exclude_kernel;
+
+static int perf_event_open(struct perf_event_attr *attr, pid_t pid)
+{
+	return syscall(__NR_perf_event_open, attr, pid, -1, -1, 0);
+}
+
+int tst_perf_open(pid_t pid)
+{
+	struct perf_event_attr attr;
+	unsigned int i;
+	int cnt = 0;
+
+	exclude_kernel = 0;
+
+	for (i = 0; i < ARRAY_SIZE(counters); i++) {
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = counters[i].type;
+		attr.config = counters[i].config;
+		attr.inherit = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+				   PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		counters[i].fd = perf_event_open(&attr, pid);
+
+		/* perf_event_paranoid >= 2 allows only user space counting */
+		if (counters[i].fd < 0 && errno == EACCES) {
+			attr.exclude_kernel = 1;
+			counters[i].fd = perf_event_open(&attr, pid);
+
+			if (counters[i].fd >= 0 && !exclude_kernel) {
+				tst_res(TINFO, "perf_event_paranoid denies "
+					"kernel profiling, counting user "
+					"space only");
+				exclude_kernel = 1;
+			}
+		}
+
+		if (counters[i].fd >= 0) {
+			cnt++;
+			continue;
+		}
+
+		if (errno == ENOSYS) {
+			tst_res(TINFO, "perf_event_open() not supported, "
+				"counters disabled");
+			return cnt;
+		}
+
+		tst_res(TINFO | TERRNO, "Cannot open %s counter",
+			counters[i].name);
+	}
+
+	return cnt;
+}
+
+static int read_counter(struct perf_counter *counter)
+{
+	uint64_t buf[3];
+
+	if (read(counter->fd, buf, sizeof(buf)) != sizeof(buf))
+		return 1;
+
+	/* Scale the value if the counter was multiplexed */
+	if (buf[2] && buf[2] < buf[1])
+		counter->val = (double)buf[0] * buf[1] / buf[2];
+	else
+		counter->val = buf[0];
+
+	return 0;
+}
+
+static void write_results(const char *tid)
+{
+	const char *path = getenv("LTP_PERF_OUTPUT");
+	unsigned int i;
+	FILE *f;
+
+	if (!path)
+		return;
+
+	f = fopen(path, "a");
+	if (!f) {
+		tst_res(TWARN | TERRNO, "Failed to open '%s'", path);
+		return;
+	}
+
+	fprintf(f, "{\"test\":\"%s\"", tid);
+
+	if (exclude_kernel)
+		fprintf(f, ",\"exclude_kernel\":true");
+
+	for (i = 0; i < ARRAY_SIZE(counters); i++) {
+		if (counters[i].fd >= 0)
+			fprintf(f, ",\"%s\":%llu", counters[i].name,
+				counters[i].val);
+	}
+
+	fprintf(f, "}\n");
+
+	if (fclose(f))
+		tst_res(TWARN | TERRNO, "Failed to close file '%s'", path);
+}
+
+void tst_perf_report(const char *tid)
+{
+	char buf[512];
+	unsigned int i;
+	int len = 0;
+
+	for (i = 0; i < ARRAY_SIZE(counters); i++) {
+		if (counters[i].fd < 0)
+			continue;
+
+		if (read_counter(&counters[i])) {
+			tst_res(TINFO | TERRNO, "Failed to read %s counter",
+				counters[i].name);
+			close(counters[i].fd);
+			counters[i].fd = -1;
+			continue;
+		}
+
+		len += snprintf(buf + len, sizeof(buf) - len, " %s %llu",
+				counters[i].name, counters[i].val);
+	}
+
+	if (len)
+		tst_res(TINFO, "perf:%s", buf);
+
+	write_results(tid);
+
+	for (i = 0; i < ARRAY_SIZE(counters); i++) {
+		if (counters[i].fd < 0)
+			continue;
+
+		close(counters[i].fd);
+		counters[i].fd = -1;
+	}
+}
+
+#else
+
+int tst_perf_open(pid_t pid LTP_ATTRIBUTE_UNUSED)
+{
+	tst_res(TINFO, "perf_event_attr not available at compile time");
+	return 0;
+}
+
+void tst_perf_report(const char *tid LTP_ATTRIBUTE_UNUSED)
+{
+}
+
+#endif /* HAVE_PERF_EVENT_ATTR */
@@ -21,57 +21,187 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#define _GNU_SOURCE
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "test.h"
+#include "lapi/syscalls.h"
 #include "tst_process_state.h"
 
-void tst_process_state_wait(const char *file, const int lineno,
-                            void (*cleanup_fn)(void),
-                            pid_t pid, const char state)
+/*
+ * The state is polled with sched_yield() in between for the first few polls,
+ * which covers the common case of a child that is about to block, then the
+ * sleep between polls doubles up to MAX_SLEEP_US. If pidfd is supported the
+ * sleep is done in ppoll() on it so that we notice the process exit.
+ */
+#define SPIN_POLLS 64
+#define MIN_SLEEP_US 50u
+#define MAX_SLEEP_US 10000u
+
+struct state_wait {
+	unsigned int polls;
+	long long elapsed_us;
+	char err[256];
+};
+
+static int read_state(int fd, char *state)
 {
-	char proc_path[128], cur_state;
+	char buf[512], *p;
+	ssize_t len;
 
-	snprintf(proc_path, sizeof(proc_path), "/proc/%i/stat", pid);
+	len = pread(fd, buf, sizeof(buf) - 1, 0);
+	if (len < 0)
+		return -1;
+
+	buf[len] = 0;
 
-	for (;;) {
-		safe_file_scanf(file, lineno, cleanup_fn, proc_path,
-		                "%*i %*s %c", &cur_state);
+	/* The comm may contain spaces and parens, the state follows last ')' */
+	p = strrchr(buf, ')');
+	if (!p || p[1] != ' ' || !p[2]) {
+		errno = EINVAL;
+		return -1;
+	}
 
-		if (state == cur_state)
-			return;
+	*state = p[2];
+	return 0;
+}
 
-		usleep(10000);
+/*
+ * Returns non-zero if the process has exited while sleeping.
+ */
+static int sleep_us(int pidfd, unsigned int us)
+{
+	struct timespec ts = {
+		.tv_sec = us / 1000000,
+		.tv_nsec = (us % 1000000) * 1000,
+	};
+	struct pollfd pfd = {.fd = pidfd, .events = POLLIN};
+
+	if (pidfd < 0) {
+		nanosleep(&ts, NULL);
+		return 0;
 	}
+
+	return ppoll(&pfd, 1, &ts, NULL) > 0;
 }
 
-int tst_process_state_wait2(pid_t pid, const char state)
+static long long now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+static int wait_state(pid_t pid, const char state, struct state_wait *wait)
 {
 	char proc_path[128], cur_state;
+	unsigned int sleep = MIN_SLEEP_US;
+	long long start = now_us();
+	int fd, pidfd, exited = 0, ret = -1;
 
 	snprintf(proc_path, sizeof(proc_path), "/proc/%i/stat", pid);
 
-	for (;;) {
-		FILE *f = fopen(proc_path, "r");
-		if (!f) {
-			fprintf(stderr, "Failed to open '%s': %s\n",
-			        proc_path, strerror(errno));
-			return 1;
+	fd = open(proc_path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		snprintf(wait->err, sizeof(wait->err), "Failed to open '%s': %s",
+			 proc_path, strerror(errno));
+		return -1;
+	}
+
+	/* Fails with ENOSYS on older kernels and with EINVAL for threads */
+	pidfd = syscall(__NR_pidfd_open, pid, 0);
+
+	for (wait->polls = 1; ; wait->polls++) {
+		if (read_state(fd, &cur_state)) {
+			snprintf(wait->err, sizeof(wait->err),
+				 "Failed to read '%s': %s",
+				 proc_path, strerror(errno));
+			break;
 		}
 
-		if (fscanf(f, "%*i %*s %c", &cur_state) != 1) {
-			fclose(f);
-			fprintf(stderr, "Failed to read '%s': %s\n",
-			        proc_path, strerror(errno));
-			return 1;
+		if (state == cur_state) {
+			ret = 0;
+			break;
 		}
-		fclose(f);
 
-		if (state == cur_state)
-			return 0;
+		if (exited) {
+			snprintf(wait->err, sizeof(wait->err),
+				 "Process %i exited while waiting for state '%c'",
+				 pid, state);
+			break;
+		}
+
+		if (wait->polls < SPIN_POLLS) {
+			sched_yield();
+			continue;
+		}
 
-		usleep(10000);
+		exited = sleep_us(pidfd, sleep);
+		sleep = MIN(2 * sleep, MAX_SLEEP_US);
 	}
+
+	wait->elapsed_us = now_us() - start;
+
+	close(fd);
+
+	if (pidfd >= 0)
+		close(pidfd);
+
+	return ret;
+}
+
+static int report_wait(void)
+{
+	static int report = -1;
+
+	if (report < 0)
+		report = !!getenv("LTP_REPORT_STATE_WAIT");
+
+	return report;
+}
+
+void tst_process_state_wait(const char *file, const int lineno,
+                            void (*cleanup_fn)(void),
+                            pid_t pid, const char state)
+{
+	struct state_wait wait;
+
+	if (wait_state(pid, state, &wait)) {
+		tst_brkm(TBROK, cleanup_fn, "%s:%d: %s",
+			 file, lineno, wait.err);
+		return;
+	}
+
+	if (report_wait()) {
+		tst_resm_(file, lineno, TINFO,
+			  "Process %i in state '%c' after %u polls (%lli us)",
+			  pid, state, wait.polls, wait.elapsed_us);
+	}
+}
+
+int tst_process_state_wait2(pid_t pid, const char state)
+{
+	struct state_wait wait;
+
+	if (wait_state(pid, state, &wait)) {
+		fprintf(stderr, "%s\n", wait.err);
+		return 1;
+	}
+
+	if (report_wait()) {
+		fprintf(stderr, "Process %i in state '%c' after %u polls (%lli us)\n",
+			pid, state, wait.polls, wait.elapsed_us);
+	}
+
+	return 0;
 }
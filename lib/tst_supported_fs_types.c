@@ -17,9 +17,13 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/mount.h>
-#include <sys/wait.h>
+#include <sys/stat.h>
+#include <sys/utsname.h>
 
 #define TST_NO_DEFAULT_MAIN
 #include "tst_test.h"
@@ -39,16 +43,23 @@ static const char *const fs_type_whitelist[] = {
 
 static const char *fs_types[ARRAY_SIZE(fs_type_whitelist)];
 
-static int has_mkfs(const char *fs_type)
+/*
+ * The shell used to be run just to find out whether the command exits with
+ * 127, i.e. is not in $PATH, looking into $PATH ourselves gives the same
+ * answer without fork() and exec().
+ */
+static int in_path(const char *prefix, const char *fs_type)
 {
-	char buf[128];
-	int ret;
+	char name[64], path[PATH_MAX];
 
-	sprintf(buf, "mkfs.%s >/dev/null 2>&1", fs_type);
+	snprintf(name, sizeof(name), "%s.%s", prefix, fs_type);
 
-	ret = tst_system(buf);
+	return !tst_get_path(name, path, sizeof(path));
+}
 
-	if (WEXITSTATUS(ret) == 127) {
+static int has_mkfs(const char *fs_type)
+{
+	if (!in_path("mkfs", fs_type)) {
 		tst_res(TINFO, "mkfs.%s does not exist", fs_type);
 		return 0;
 	}
@@ -61,7 +72,6 @@ static int has_kernel_support(const char *fs_type)
 {
 	static int fuse_supported = -1;
 	const char *tmpdir = getenv("TMPDIR");
-	char buf[128];
 	int ret;
 
 	if (!tmpdir)
@@ -88,10 +98,7 @@ static int has_kernel_support(const char *fs_type)
 		return 0;
 
 	/* Is FUSE implementation installed? */
-	sprintf(buf, "mount.%s >/dev/null 2>&1", fs_type);
-
-	ret = tst_system(buf);
-	if (WEXITSTATUS(ret) == 127) {
+	if (!in_path("mount", fs_type)) {
 		tst_res(TINFO, "Filesystem %s is not supported", fs_type);
 		return 0;
 	}
@@ -105,14 +112,174 @@ int tst_fs_is_supported(const char *fs_type)
 	return has_kernel_support(fs_type) && has_mkfs(fs_type);
 }
 
+/* FNV-1a */
+static uint64_t hash_str(uint64_t hash, const char *str)
+{
+	while (*str) {
+		hash ^= (unsigned char)*str++;
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+/*
+ * The probe results depend on the kernel, the modules installed for it, FUSE
+ * availability and the content of the $PATH directories. Modification time
+ * of a directory changes when a binary is added or removed.
+ */
+static int cache_key(char *key, size_t size)
+{
+	char *path = getenv("PATH"), *dirs, *dir, *save = NULL;
+	char buf[PATH_MAX + 64];
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	struct utsname uts;
+	struct stat st;
+
+	if (!path || uname(&uts))
+		return 1;
+
+	snprintf(buf, sizeof(buf), "/lib/modules/%s/modules.dep", uts.release);
+	if (stat(buf, &st))
+		st.st_mtime = 0;
+
+	snprintf(buf, sizeof(buf), "%s %lli %i", uts.release,
+		 (long long)st.st_mtime, !access("/dev/fuse", F_OK));
+	hash = hash_str(hash, buf);
+
+	dirs = strdup(path);
+	if (!dirs)
+		return 1;
+
+	for (dir = strtok_r(dirs, ":", &save); dir;
+	     dir = strtok_r(NULL, ":", &save)) {
+		if (stat(dir, &st))
+			st.st_mtime = 0;
+
+		snprintf(buf, sizeof(buf), ":%s %lli", dir,
+			 (long long)st.st_mtime);
+		hash = hash_str(hash, buf);
+	}
+
+	free(dirs);
+
+	snprintf(key, size, "%s %016"PRIx64, uts.release, hash);
+	return 0;
+}
+
+static void cache_path(char *path, size_t size)
+{
+	const char *tmpdir = getenv("TMPDIR");
+
+	snprintf(path, size, "%s/ltp_supported_fs.%u", tmpdir ? tmpdir : "/tmp",
+		 (unsigned int)getuid());
+}
+
+static int cache_load(const char *path, const char *key)
+{
+	char buf[256], *name, *save = NULL;
+	unsigned int i, k, j = 0;
+	struct stat st;
+	FILE *f;
+
+	f = fopen(path, "r");
+	if (!f)
+		return 1;
+
+	/* Ignore files planted by other users into shared TMPDIR */
+	if (fstat(fileno(f), &st) || st.st_uid != getuid())
+		goto err;
+
+	if (!fgets(buf, sizeof(buf), f) || strncmp(buf, key, strlen(key))
+	    || buf[strlen(key)] != '\n')
+		goto err;
+
+	if (!fgets(buf, sizeof(buf), f))
+		goto err;
+
+	for (name = strtok_r(buf, " \n", &save); name;
+	     name = strtok_r(NULL, " \n", &save)) {
+		for (i = 0; fs_type_whitelist[i]; i++) {
+			if (!strcmp(name, fs_type_whitelist[i]))
+				break;
+		}
+
+		if (!fs_type_whitelist[i] || j >= ARRAY_SIZE(fs_types) - 1)
+			goto err;
+
+		for (k = 0; k < j; k++) {
+			if (fs_types[k] == fs_type_whitelist[i])
+				goto err;
+		}
+
+		fs_types[j++] = fs_type_whitelist[i];
+	}
+
+	fs_types[j] = NULL;
+	fclose(f);
+	return 0;
+err:
+	fs_types[0] = NULL;
+	fclose(f);
+	return 1;
+}
+
+static void cache_store(const char *path, const char *key)
+{
+	char tmp[PATH_MAX + 16];
+	unsigned int i;
+	FILE *f;
+	int fd;
+
+	/* mkstemp() creates the file with O_EXCL, never follows a planted link */
+	snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+
+	fd = mkstemp(tmp);
+	if (fd < 0)
+		return;
+
+	f = fdopen(fd, "w");
+	if (!f) {
+		close(fd);
+		unlink(tmp);
+		return;
+	}
+
+	fprintf(f, "%s\n", key);
+
+	for (i = 0; fs_types[i]; i++)
+		fprintf(f, "%s%s", i ? " " : "", fs_types[i]);
+
+	fprintf(f, "\n");
+
+	if (fclose(f) || rename(tmp, path))
+		unlink(tmp);
+}
+
 const char **tst_get_supported_fs_types(void)
 {
+	char key[128], path[PATH_MAX];
 	unsigned int i, j = 0;
+	int cache = !cache_key(key, sizeof(key));
+
+	cache_path(path, sizeof(path));
+
+	if (cache && !cache_load(path, key)) {
+		tst_res(TINFO, "Supported filesystems cached in %s", path);
+
+		for (i = 0; fs_types[i]; i++)
+			tst_res(TINFO, "Kernel and mkfs support %s", fs_types[i]);
+
+		return fs_types;
+	}
 
 	for (i = 0; fs_type_whitelist[i]; i++) {
 		if (tst_fs_is_supported(fs_type_whitelist[i]))
 			fs_types[j++] = fs_type_whitelist[i];
 	}
 
+	if (cache)
+		cache_store(path, key);
+
 	return fs_types;
 }
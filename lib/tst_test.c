@@ -21,9 +21,11 @@
 #include <string.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <poll.h>
 #include <sys/mount.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/resource.h>
 
 #define TST_NO_DEFAULT_MAIN
 #include "tst_test.h"
@@ -33,8 +35,16 @@
 #include "tst_ansi_color.h"
 #include "tst_safe_stdio.h"
 #include "tst_timer_test.h"
+#include "tst_bench.h"
+#include "tst_perf.h"
+#include "tst_kstat.h"
+#include "tst_json.h"
+#include "tst_cgroup.h"
+#include "tst_ftrace.h"
+#include "tst_log_ring.h"
 #include "tst_clocks.h"
 #include "tst_timer.h"
+#include "tst_tsc.h"
 #include "tst_sys_conf.h"
 
 #include "old_resource.h"
@@ -49,6 +59,30 @@ static float duration = -1;
 static pid_t main_pid, lib_pid;
 static int mntpoint_mounted;
 static struct timespec tst_start_time; /* valid only for test pid */
+static struct timespec lib_start_time, fork_start_time;
+static int report_startup;
+static unsigned int fs_jobs = 1;
+static int fs_worker;
+static int perf_counters;
+static int kstat;
+static int cgroup;
+static int ftrace;
+static char log_prefix[32];
+
+/*
+ * Resource usage of the test process and the children it has waited for,
+ * summed over all test runs except for maxrss which is the largest one.
+ */
+struct run_usage {
+	unsigned int runs;
+	unsigned long long utime_us;
+	unsigned long long stime_us;
+	long maxrss_kb;
+	long minflt;
+	long majflt;
+	long nvcsw;
+	long nivcsw;
+};
 
 struct results {
 	int passed;
@@ -56,6 +90,9 @@ struct results {
 	int failed;
 	int warnings;
 	unsigned int timeout;
+	/* set by the test process once it's ready to run the test */
+	struct timespec test_ready_time;
+	struct run_usage usage;
 };
 
 static struct results *results;
@@ -71,6 +108,7 @@ static char ipc_path[1024];
 const char *tst_ipc_path = ipc_path;
 
 static char shm_path[1024];
+static size_t ipc_size;
 
 int TST_ERR;
 long TST_RET;
@@ -78,9 +116,34 @@ long TST_RET;
 static void do_cleanup(void);
 static void do_exit(int ret) __attribute__ ((noreturn));
 
+static size_t get_ipc_size(void)
+{
+	size_t page_size = getpagesize();
+	size_t size;
+
+	if (!tst_test->max_checkpoints)
+		return page_size;
+
+	size = sizeof(struct results) + sizeof(futex_t) *
+	       tst_checkpoint_futexes(tst_test->max_checkpoints);
+
+	return (size + page_size - 1) / page_size * page_size;
+}
+
 static void setup_ipc(void)
 {
-	size_t size = getpagesize();
+	size_t size = ipc_size = get_ipc_size();
+
+	/*
+	 * The backing file is needed only if the IPC region has to be reachable
+	 * from processes started by exec(), plain shared anonymous mapping is
+	 * inherited over fork() and saves the file creation and removal.
+	 */
+	if (!tst_test->needs_checkpoints && !tst_test->child_needs_reinit) {
+		results = SAFE_MMAP(NULL, size, PROT_READ | PROT_WRITE,
+		                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+		return;
+	}
 
 	if (access("/dev/shm", F_OK) == 0) {
 		snprintf(shm_path, sizeof(shm_path), "/dev/shm/ltp_%s_%d",
@@ -107,12 +170,8 @@ static void setup_ipc(void)
 	results = SAFE_MMAP(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, ipc_fd, 0);
 
 	/* Checkpoints needs to be accessible from processes started by exec() */
-	if (tst_test->needs_checkpoints || tst_test->child_needs_reinit) {
-		sprintf(ipc_path, IPC_ENV_VAR "=%s", shm_path);
-		putenv(ipc_path);
-	} else {
-		SAFE_UNLINK(shm_path);
-	}
+	sprintf(ipc_path, IPC_ENV_VAR "=%s", shm_path);
+	putenv(ipc_path);
 
 	SAFE_CLOSE(ipc_fd);
 
@@ -124,7 +183,7 @@ static void setup_ipc(void)
 
 static void cleanup_ipc(void)
 {
-	size_t size = getpagesize();
+	size_t size = ipc_size;
 
 	if (ipc_fd > 0 && close(ipc_fd))
 		tst_res(TWARN | TERRNO, "close(ipc_fd) failed");
@@ -141,7 +200,8 @@ static void cleanup_ipc(void)
 void tst_reinit(void)
 {
 	const char *path = getenv(IPC_ENV_VAR);
-	size_t size = getpagesize();
+	struct stat st;
+	size_t size;
 	int fd;
 
 	if (!path)
@@ -151,12 +211,16 @@ void tst_reinit(void)
 		tst_brk(TBROK, "File %s does not exist!", path);
 
 	fd = SAFE_OPEN(path, O_RDWR);
+	SAFE_FSTAT(fd, &st);
+	size = st.st_size;
 
 	results = SAFE_MMAP(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
 	tst_futexes = (char*)results + sizeof(struct results);
 	tst_max_futexes = (size - sizeof(struct results))/sizeof(futex_t);
 
 	SAFE_CLOSE(fd);
+
+	tst_json_init();
 }
 
 static void update_results(int ttype)
@@ -184,7 +248,7 @@ static void print_result(const char *file, const int lineno, int ttype,
                          const char *fmt, va_list va)
 {
 	char buf[1024];
-	char *str = buf;
+	char *str = buf, *msg;
 	int ret, size = sizeof(buf), ssize;
 	const char *str_errno = NULL;
 	const char *res;
@@ -224,7 +288,7 @@ static void print_result(const char *file, const int lineno, int ttype,
 		str_errno = tst_strerrno(ret);
 	}
 
-	ret = snprintf(str, size, "%s:%i: ", file, lineno);
+	ret = snprintf(str, size, "%s%s:%i: ", log_prefix, file, lineno);
 	str += ret;
 	size -= ret;
 
@@ -236,6 +300,7 @@ static void print_result(const char *file, const int lineno, int ttype,
 	str += ret;
 	size -= ret;
 
+	msg = str;
 	ssize = size - 2;
 	ret = vsnprintf(str, size, fmt, va);
 	str += MIN(ret, ssize);
@@ -255,7 +320,12 @@ static void print_result(const char *file, const int lineno, int ttype,
 
 	snprintf(str, size, "\n");
 
-	fputs(buf, stderr);
+	if (!tst_log_ring_put(buf)) {
+		tst_log_ring_drain(0);
+		fputs(buf, stderr);
+	}
+
+	tst_json_res(file, lineno, res, msg);
 }
 
 void tst_vres_(const char *file, const int lineno, int ttype,
@@ -286,12 +356,16 @@ static void tst_cvres(const char *file, const int lineno, int ttype,
 
 static void do_test_cleanup(void)
 {
+	unsigned long long start = tst_json_ts();
+
 	tst_brk_handler = tst_cvres;
 
 	if (tst_test->cleanup)
 		tst_test->cleanup();
 
 	tst_brk_handler = tst_vbrk_;
+
+	tst_json_phase("cleanup", -1, start);
 }
 
 void tst_vbrk_(const char *file, const int lineno, int ttype,
@@ -583,14 +657,35 @@ int tst_parse_float(const char *str, float *val, float min, float max)
 	return 0;
 }
 
+static void fs_worker_exit(int ret) __attribute__ ((noreturn));
+
+static void print_usage(const struct run_usage *u)
+{
+	if (!u->runs)
+		return;
+
+	printf("utime    %llu.%06llus\n", u->utime_us / 1000000,
+	       u->utime_us % 1000000);
+	printf("stime    %llu.%06llus\n", u->stime_us / 1000000,
+	       u->stime_us % 1000000);
+	printf("maxrss   %likB\n", u->maxrss_kb);
+	printf("faults   %li minor, %li major\n", u->minflt, u->majflt);
+	printf("ctxsw    %li voluntary, %li involuntary\n", u->nvcsw,
+	       u->nivcsw);
+}
+
 static void do_exit(int ret)
 {
+	if (fs_worker)
+		fs_worker_exit(ret);
+
 	if (results) {
 		printf("\nSummary:\n");
 		printf("passed   %d\n", results->passed);
 		printf("failed   %d\n", results->failed);
 		printf("skipped  %d\n", results->skipped);
 		printf("warnings %d\n", results->warnings);
+		print_usage(&results->usage);
 
 		if (results->passed && ret == TCONF)
 			ret = 0;
@@ -689,6 +784,9 @@ static void assert_test_fn(void)
 	if (tst_test->sample)
 		cnt++;
 
+	if (tst_test->bench)
+		cnt++;
+
 	if (!cnt)
 		tst_brk(TBROK, "No test function speficied");
 
@@ -762,6 +860,44 @@ static void prepare_device(void)
 	}
 }
 
+/*
+ * The all_filesystems variants can run concurrently, each in a worker process
+ * with its own subdirectory, device and mntpoint. That is not possible if the
+ * test shares anything else, such as checkpoints, resource files or a single
+ * LTP_DEV, between the runs.
+ */
+static void setup_fs_jobs(void)
+{
+	const char *jobs = getenv("LTP_FS_JOBS");
+	const char *reason = NULL;
+	int val;
+
+	if (!jobs)
+		return;
+
+	if (tst_parse_int(jobs, &val, 1, INT_MAX))
+		tst_brk(TBROK, "Invalid LTP_FS_JOBS '%s'", jobs);
+
+	if (val == 1)
+		return;
+
+	if (tst_test->needs_checkpoints || tst_test->child_needs_reinit)
+		reason = "test uses checkpoints";
+	else if (tst_test->resource_files)
+		reason = "test uses resource files";
+	else if (getenv("LTP_DEV"))
+		reason = "LTP_DEV is set";
+	else if (!tst_test->mntpoint || tst_test->mntpoint[0] == '/')
+		reason = "mntpoint is not relative";
+
+	if (reason) {
+		tst_res(TINFO, "Ignoring LTP_FS_JOBS, %s", reason);
+		return;
+	}
+
+	fs_jobs = val;
+}
+
 static void do_setup(int argc, char *argv[])
 {
 	if (!tst_test)
@@ -777,6 +913,9 @@ static void do_setup(int argc, char *argv[])
 	if (tst_test->sample)
 		tst_test = tst_timer_test_setup(tst_test);
 
+	if (tst_test->bench)
+		tst_test = tst_bench_setup(tst_test);
+
 	parse_opts(argc, argv);
 
 	if (tst_test->needs_root && geteuid() != 0)
@@ -797,13 +936,18 @@ static void do_setup(int argc, char *argv[])
 	if (tst_test->format_device)
 		tst_test->needs_device = 1;
 
+	if (tst_test->max_checkpoints)
+		tst_test->needs_checkpoints = 1;
+
 	if (tst_test->mount_device) {
 		tst_test->needs_device = 1;
 		tst_test->format_device = 1;
 	}
 
-	if (tst_test->all_filesystems)
+	if (tst_test->all_filesystems) {
 		tst_test->needs_device = 1;
+		setup_fs_jobs();
+	}
 
 	setup_ipc();
 
@@ -849,7 +993,7 @@ static void do_setup(int argc, char *argv[])
 		}
 	}
 
-	if (tst_test->needs_device && !mntpoint_mounted) {
+	if (tst_test->needs_device && !mntpoint_mounted && fs_jobs == 1) {
 		tdev.dev = tst_acquire_device_(NULL, tst_test->dev_min_size);
 
 		if (!tdev.dev)
@@ -872,6 +1016,8 @@ static void do_setup(int argc, char *argv[])
 
 static void do_test_setup(void)
 {
+	unsigned long long start = tst_json_ts();
+
 	main_pid = getpid();
 
 	if (tst_test->setup)
@@ -879,6 +1025,8 @@ static void do_test_setup(void)
 
 	if (main_pid != getpid())
 		tst_brk(TBROK, "Runaway child in setup()!");
+
+	tst_json_phase("setup", -1, start);
 }
 
 static void do_cleanup(void)
@@ -901,13 +1049,27 @@ static void do_cleanup(void)
 	cleanup_ipc();
 }
 
+static unsigned int tcase_idx, tcase_calls;
+
+unsigned int tst_tcase_idx(unsigned int *calls)
+{
+	if (calls)
+		*calls = tcase_calls;
+
+	return tcase_idx;
+}
+
 static void run_tests(void)
 {
 	unsigned int i;
 	struct results saved_results;
+	unsigned long long start;
 
 	if (!tst_test->test) {
 		saved_results = *results;
+		start = tst_json_ts();
+		tcase_idx = 0;
+		tcase_calls++;
 		tst_test->test_all();
 
 		if (getpid() != main_pid) {
@@ -915,6 +1077,7 @@ static void run_tests(void)
 		}
 
 		tst_reap_children();
+		tst_json_phase("test", 0, start);
 
 		if (results_equal(&saved_results, results))
 			tst_brk(TBROK, "Test haven't reported results!");
@@ -923,6 +1086,9 @@ static void run_tests(void)
 
 	for (i = 0; i < tst_test->tcnt; i++) {
 		saved_results = *results;
+		start = tst_json_ts();
+		tcase_idx = i;
+		tcase_calls++;
 		tst_test->test(i);
 
 		if (getpid() != main_pid) {
@@ -930,6 +1096,7 @@ static void run_tests(void)
 		}
 
 		tst_reap_children();
+		tst_json_phase("test", i, start);
 
 		if (results_equal(&saved_results, results))
 			tst_brk(TBROK, "Test %i haven't reported results!", i);
@@ -978,6 +1145,7 @@ static void testrun(void)
 	int cont = 1;
 
 	heartbeat();
+	results->test_ready_time = tst_start_time;
 	add_paths();
 	do_test_setup();
 
@@ -1021,6 +1189,9 @@ static void alarm_handler(int sig LTP_ATTRIBUTE_UNUSED)
 {
 	WRITE_MSG("Test timeouted, sending SIGKILL!\n");
 	kill(-test_pid, SIGKILL);
+
+	if (cgroup)
+		tst_cgroup_kill();
 	alarm(5);
 
 	if (++sigkill_retries > 10) {
@@ -1042,6 +1213,9 @@ static void sigint_handler(int sig LTP_ATTRIBUTE_UNUSED)
 	if (test_pid > 0) {
 		WRITE_MSG("Sending SIGKILL to test process...\n");
 		kill(-test_pid, SIGKILL);
+
+		if (cgroup)
+			tst_cgroup_kill();
 	}
 }
 
@@ -1090,9 +1264,127 @@ void tst_set_timeout(int timeout)
 		heartbeat();
 }
 
+/*
+ * Cold start is the time from the library entry point until the test process
+ * is ready to run, fork start is the part of it spent after the library has
+ * been initialized, i.e. what a test started from a pre-initialized parent
+ * would pay.
+ */
+static void print_startup_times(void)
+{
+	struct timespec ready = results->test_ready_time;
+
+	if (!ready.tv_sec && !ready.tv_nsec)
+		return;
+
+	tst_res(TINFO, "Startup times: cold %lldus, fork %lldus",
+		tst_timespec_diff_us(ready, lib_start_time),
+		tst_timespec_diff_us(ready, fork_start_time));
+}
+
+/*
+ * The test process waits until the counters are attached and the tracing is
+ * started so that the whole test run is accounted, the pipe is closed by the
+ * parent afterwards.
+ */
+static void wait_for_parent(int start_pipe[2])
+{
+	char c;
+
+	SAFE_CLOSE(start_pipe[1]);
+	SAFE_READ(0, start_pipe[0], &c, 1);
+	SAFE_CLOSE(start_pipe[0]);
+}
+
+/* Failures, tst_brk() and signals, i.e. timeouts, in the test run */
+static int run_failed(int status, int failed_before)
+{
+	if (results->failed != failed_before || WIFSIGNALED(status))
+		return 1;
+
+	return WIFEXITED(status) && (WEXITSTATUS(status) & (TFAIL | TBROK));
+}
+
+static void add_usage(struct run_usage *sum, const struct run_usage *u)
+{
+	sum->runs += u->runs;
+	sum->utime_us += u->utime_us;
+	sum->stime_us += u->stime_us;
+	sum->maxrss_kb = MAX(sum->maxrss_kb, u->maxrss_kb);
+	sum->minflt += u->minflt;
+	sum->majflt += u->majflt;
+	sum->nvcsw += u->nvcsw;
+	sum->nivcsw += u->nivcsw;
+}
+
+static void account_usage(const struct rusage *ru)
+{
+	struct run_usage u = {
+		.runs = 1,
+		.utime_us = ru->ru_utime.tv_sec * 1000000ULL + ru->ru_utime.tv_usec,
+		.stime_us = ru->ru_stime.tv_sec * 1000000ULL + ru->ru_stime.tv_usec,
+		.maxrss_kb = ru->ru_maxrss,
+		.minflt = ru->ru_minflt,
+		.majflt = ru->ru_majflt,
+		.nvcsw = ru->ru_nvcsw,
+		.nivcsw = ru->ru_nivcsw,
+	};
+
+	add_usage(&results->usage, &u);
+
+	tst_json_event("rusage", "\"utime_us\":%llu,\"stime_us\":%llu,"
+		       "\"maxrss_kb\":%li,\"minflt\":%li,\"majflt\":%li,"
+		       "\"nvcsw\":%li,\"nivcsw\":%li", u.utime_us, u.stime_us,
+		       u.maxrss_kb, u.minflt, u.majflt, u.nvcsw, u.nivcsw);
+}
+
+/*
+ * Reaps the test process with wait4() so that its resource usage, including
+ * the children it has waited for, is not lost.
+ */
+static pid_t wait_test(int *status, int options, struct rusage *ru)
+{
+	pid_t pid = wait4(test_pid, status, options, ru);
+
+	if (pid < 0)
+		tst_brk(TBROK | TERRNO, "wait4(%i)", test_pid);
+
+	return pid;
+}
+
+#define LOG_DRAIN_MS 10
+
+/*
+ * The ring is drained every LOG_DRAIN_MS while the test runs, the wait is
+ * done in poll() on a pidfd so that the test exit is noticed right away.
+ * Kernels without pidfd_open() (< 5.3) fall back to sleeping.
+ */
+static void wait_drain_log(int *status, struct rusage *ru)
+{
+	struct pollfd pfd = {.events = POLLIN};
+
+	pfd.fd = syscall(__NR_pidfd_open, test_pid, 0);
+
+	while (!wait_test(status, WNOHANG, ru)) {
+		tst_log_ring_drain(0);
+
+		if (pfd.fd < 0)
+			usleep(LOG_DRAIN_MS * 1000);
+		else
+			poll(&pfd, 1, LOG_DRAIN_MS);
+	}
+
+	if (pfd.fd >= 0)
+		close(pfd.fd);
+
+	tst_log_ring_drain(1);
+}
+
 static int fork_testrun(void)
 {
-	int status;
+	int status, start_pipe[2], log_ring, failed_before;
+	int wait_parent = perf_counters || ftrace;
+	struct rusage ru;
 
 	if (tst_test->timeout)
 		tst_set_timeout(tst_test->timeout);
@@ -1101,6 +1393,29 @@ static int fork_testrun(void)
 
 	SAFE_SIGNAL(SIGINT, sigint_handler);
 
+	if (report_startup) {
+		memset(&results->test_ready_time, 0,
+		       sizeof(results->test_ready_time));
+		tst_clock_gettime(CLOCK_MONOTONIC, &fork_start_time);
+	}
+
+	if (wait_parent)
+		SAFE_PIPE(start_pipe);
+
+	if (kstat)
+		tst_kstat_snapshot(0);
+
+	tst_json_flush();
+	log_ring = tst_log_ring_init();
+
+	if (cgroup)
+		tst_cgroup_create(tst_test);
+
+	if (ftrace)
+		tst_ftrace_arm();
+
+	failed_before = results->failed;
+
 	test_pid = fork();
 	if (test_pid < 0)
 		tst_brk(TBROK | TERRNO, "fork()");
@@ -1110,13 +1425,57 @@ static int fork_testrun(void)
 		SAFE_SIGNAL(SIGUSR1, SIG_DFL);
 		SAFE_SIGNAL(SIGINT, SIG_DFL);
 		SAFE_SETPGID(0, 0);
+
+		if (cgroup)
+			tst_cgroup_join();
+
+		tst_log_ring_producer();
+
+		if (wait_parent)
+			wait_for_parent(start_pipe);
+
 		testrun();
 	}
 
-	SAFE_WAITPID(test_pid, &status, 0);
+	if (wait_parent) {
+		SAFE_CLOSE(start_pipe[0]);
+
+		if (perf_counters)
+			tst_perf_open(test_pid);
+
+		if (ftrace)
+			tst_ftrace_start(test_pid);
+
+		SAFE_CLOSE(start_pipe[1]);
+	}
+
+	if (log_ring)
+		wait_drain_log(&status, &ru);
+	else
+		wait_test(&status, 0, &ru);
+
 	alarm(0);
 	SAFE_SIGNAL(SIGINT, SIG_DFL);
 
+	account_usage(&ru);
+
+	if (ftrace)
+		tst_ftrace_stop(run_failed(status, failed_before));
+
+	if (cgroup)
+		tst_cgroup_destroy();
+
+	if (kstat) {
+		tst_kstat_snapshot(1);
+		tst_kstat_report();
+	}
+
+	if (report_startup)
+		print_startup_times();
+
+	if (perf_counters)
+		tst_perf_report(tid);
+
 	if (WIFEXITED(status) && WEXITSTATUS(status))
 		return WEXITSTATUS(status);
 
@@ -1132,6 +1491,149 @@ static int fork_testrun(void)
 	return 0;
 }
 
+static void fs_worker_exit(int ret)
+{
+	if (mntpoint_mounted)
+		tst_umount(tst_test->mntpoint);
+
+	if (tdev.dev)
+		tst_release_device(tdev.dev);
+
+	exit(ret);
+}
+
+static void run_fs_worker(const char *fs_type, struct results *slot)
+{
+	char dir[PATH_MAX];
+
+	fs_worker = 1;
+	lib_pid = getpid();
+	results = slot;
+	snprintf(log_prefix, sizeof(log_prefix), "[%s] ", fs_type);
+
+	snprintf(dir, sizeof(dir), "fs_%s", fs_type);
+	SAFE_MKDIR(dir, 0777);
+	SAFE_CHDIR(dir);
+	SAFE_MKDIR(tst_test->mntpoint, 0777);
+
+	tdev.dev = tst_acquire_device_(NULL, tst_test->dev_min_size);
+	tdev.fs_type = fs_type;
+	tst_device = &tdev;
+
+	prepare_device();
+
+	fs_worker_exit(fork_testrun());
+}
+
+struct fs_job {
+	pid_t pid;
+	int ret;
+	unsigned long long start;
+	unsigned long long end;
+};
+
+static void reap_fs_job(struct fs_job *jobs, unsigned int cnt)
+{
+	unsigned int i;
+	int status;
+	pid_t pid;
+
+	pid = SAFE_WAITPID(-1, &status, 0);
+
+	for (i = 0; i < cnt; i++) {
+		if (jobs[i].pid == pid)
+			break;
+	}
+
+	if (i >= cnt)
+		tst_brk(TBROK, "Reaped unknown child %i", pid);
+
+	jobs[i].end = get_time_ms();
+
+	if (WIFEXITED(status)) {
+		jobs[i].ret = WEXITSTATUS(status);
+		return;
+	}
+
+	tst_res(TINFO, "Worker %i %s", pid, tst_strstatus(status));
+	jobs[i].ret = TBROK;
+}
+
+/*
+ * Each worker accumulates its results in its own slot placed after the main
+ * results in the IPC page, these are merged in the filesystem order once all
+ * the workers have finished so that the output does not depend on the order
+ * the workers have finished in.
+ */
+static int run_tcases_per_fs_parallel(const char *const *filesystems)
+{
+	unsigned int i, cnt, started = 0, running = 0;
+	struct results *slots = results + 1;
+	struct fs_job *jobs;
+	int ret = 0;
+
+	for (cnt = 0; filesystems[cnt]; cnt++);
+
+	if ((cnt + 1) * sizeof(struct results) > (size_t)getpagesize())
+		tst_brk(TBROK, "Not enough space for %u results", cnt);
+
+	jobs = SAFE_MALLOC(cnt * sizeof(*jobs));
+
+	tst_res(TINFO, "Testing %u filesystems with %u jobs", cnt, fs_jobs);
+	tst_flush();
+
+	while (started < cnt || running) {
+		if (started < cnt && running < fs_jobs) {
+			tst_res(TINFO, "Testing on %s", filesystems[started]);
+			tst_flush();
+
+			jobs[started].start = get_time_ms();
+			jobs[started].pid = fork();
+			if (jobs[started].pid < 0)
+				tst_brk(TBROK | TERRNO, "fork()");
+
+			if (!jobs[started].pid)
+				run_fs_worker(filesystems[started], &slots[started]);
+
+			started++;
+			running++;
+			continue;
+		}
+
+		reap_fs_job(jobs, started);
+		running--;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		tst_res(TINFO, "%s: passed %i failed %i skipped %i warnings %i "
+			"(exit %i) in %llums", filesystems[i],
+			slots[i].passed, slots[i].failed, slots[i].skipped,
+			slots[i].warnings, jobs[i].ret,
+			jobs[i].end - jobs[i].start);
+
+		results->passed += slots[i].passed;
+		results->failed += slots[i].failed;
+		results->skipped += slots[i].skipped;
+		results->warnings += slots[i].warnings;
+		add_usage(&results->usage, &slots[i].usage);
+
+		if (jobs[i].ret == TCONF) {
+			update_results(TCONF);
+			continue;
+		}
+
+		if (jobs[i].ret && !ret)
+			ret = jobs[i].ret;
+	}
+
+	free(jobs);
+
+	if (ret)
+		do_exit(ret);
+
+	return 0;
+}
+
 static int run_tcases_per_fs(void)
 {
 	int ret = 0;
@@ -1141,6 +1643,9 @@ static int run_tcases_per_fs(void)
 	if (!filesystems[0])
 		tst_brk(TCONF, "There are no supported filesystems");
 
+	if (fs_jobs > 1)
+		return run_tcases_per_fs_parallel(filesystems);
+
 	for (i = 0; filesystems[i]; i++) {
 
 		tst_res(TINFO, "Testing on %s", filesystems[i]);
@@ -1176,6 +1681,19 @@ void tst_run_tcases(int argc, char *argv[], struct tst_test *self)
 	lib_pid = getpid();
 	tst_test = self;
 
+	/* Taken first so that the cold startup time includes the library init */
+	if (getenv("LTP_REPORT_STARTUP")) {
+		report_startup = 1;
+		tst_clock_gettime(CLOCK_MONOTONIC, &lib_start_time);
+	}
+
+	perf_counters = tst_perf_enabled();
+	kstat = !!tst_kstat_enabled();
+	cgroup = !tst_cgroup_init();
+	ftrace = !tst_ftrace_init();
+	tst_json_init();
+	tst_tsc_init();
+
 	do_setup(argc, argv);
 
 	TCID = tid;
@@ -1204,4 +1722,6 @@ void tst_flush(void)
 	if (rval != 0)
 		tst_brk(TBROK | TERRNO, "fflush(stdout) failed");
 
+	tst_json_flush();
+
 }
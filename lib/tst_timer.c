@@ -10,10 +10,24 @@
 #include "tst_test.h"
 #include "tst_timer.h"
 #include "tst_clocks.h"
+#include "tst_tsc.h"
 #include "lapi/posix_clocks.h"
 
-static struct timespec start_time, stop_time;
-static clockid_t clock_id;
+/* Per thread so that the timer tests can sample from several threads */
+static __thread struct timespec start_time, stop_time;
+static __thread clockid_t clock_id;
+
+/* The cycle counter stands in for the monotonic clocks if enabled */
+static int get_time(struct timespec *ts)
+{
+	if (tst_tsc.enabled && (clock_id == CLOCK_MONOTONIC
+	    || clock_id == CLOCK_MONOTONIC_RAW)) {
+		tst_tsc_gettime(ts);
+		return 0;
+	}
+
+	return tst_clock_gettime(clock_id, ts);
+}
 
 static const char *clock_name(clockid_t clk_id)
 {
@@ -57,7 +71,7 @@ void tst_timer_start(clockid_t clk_id)
 {
 	clock_id = clk_id;
 
-	if (tst_clock_gettime(clock_id, &start_time))
+	if (get_time(&start_time))
 		tst_res(TWARN | TERRNO, "tst_clock_gettime() failed");
 }
 
@@ -65,7 +79,7 @@ int tst_timer_expired_ms(long long ms)
 {
 	struct timespec cur_time;
 
-	if (tst_clock_gettime(clock_id, &cur_time))
+	if (get_time(&cur_time))
 		tst_res(TWARN | TERRNO, "tst_clock_gettime() failed");
 
 	return tst_timespec_diff_ms(cur_time, start_time) >= ms;
@@ -73,7 +87,7 @@ int tst_timer_expired_ms(long long ms)
 
 void tst_timer_stop(void)
 {
-	if (tst_clock_gettime(clock_id, &stop_time))
+	if (get_time(&stop_time))
 		tst_res(TWARN | TERRNO, "tst_clock_gettime() failed");
 }
 
@@ -15,7 +15,10 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define _GNU_SOURCE
 #include <sys/prctl.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <limits.h>
@@ -24,8 +27,9 @@
 #include "tst_test.h"
 #include "tst_clocks.h"
 #include "tst_timer_test.h"
-
-#define MAX_SAMPLES 500
+#include "tst_histogram.h"
+#include "tst_bench.h"
+#include "tst_safe_pthread.h"
 
 static const char *scall;
 static void (*setup)(void);
@@ -33,17 +37,40 @@ static void (*cleanup)(void);
 static int (*sample)(int clk_id, long long usec);
 static struct tst_test *test;
 
-static long long *samples;
-static unsigned int cur_sample;
+/*
+ * Each sampling thread records into its own histogram, the histograms are
+ * merged once the sampling is done. Early wakeups and outliners are counted
+ * exactly since these are checked against fixed limits.
+ */
+struct sampler {
+	pthread_t thread;
+	int cpu;
+	int failed;
+	struct tst_histogram *hist;
+	unsigned int early;
+	long long early_min, early_max;
+	unsigned int outliners;
+	long long outliner_min, outliner_max;
+};
+
+static struct sampler *samplers;
+static __thread struct sampler *cur_sampler;
+static struct tst_histogram *hist;
+static long long cur_usec;
+static unsigned int thread_samples;
+static long long outliner_limit;
 static unsigned int monotonic_resolution;
 static unsigned int timerslack;
+static FILE *sample_file;
 
 static char *print_frequency_plot;
 static char *file_name;
 static char *str_sleep_time;
 static char *str_sample_cnt;
+static char *str_threads;
 static int sleep_time = -1;
 static int sample_cnt;
+static int threads = 1;
 
 static void print_line(char c, int len)
 {
@@ -90,8 +117,8 @@ static void frequency_plot(void)
 	unsigned int cols = 80;
 	unsigned int rows = 20;
 	unsigned int i, buckets[rows];
-	long long max_sample = samples[0];
-	long long min_sample = samples[cur_sample-1];
+	long long max_sample = hist->max;
+	long long min_sample = hist->min;
 	unsigned int line_header_len = header_len(max_sample);
 	unsigned int plot_line_len = cols - line_header_len;
 	unsigned int bucket_size;
@@ -105,10 +132,15 @@ static void frequency_plot(void)
 	 */
 	bucket_size = MAX(1u, ceilu(1.00 * (max_sample - min_sample)/(rows-1)));
 
-	for (i = 0; i < cur_sample; i++) {
+	for (i = 0; i < TST_HISTOGRAM_BUCKETS; i++) {
 		unsigned int bucket;
-		bucket = flooru(1.00 * (samples[i] - min_sample)/bucket_size);
-		buckets[bucket]++;
+
+		if (!hist->buckets[i])
+			continue;
+
+		bucket = flooru(1.00 * (tst_histogram_bucket_value(hist, i)
+				- min_sample)/bucket_size);
+		buckets[bucket] += hist->buckets[i];
 	}
 
 	unsigned int max_bucket = buckets[0];
@@ -163,14 +195,29 @@ static void frequency_plot(void)
 
 void tst_timer_sample(void)
 {
-	samples[cur_sample++] = tst_timer_elapsed_us();
-}
+	struct sampler *s = cur_sampler;
+	long long val = tst_timer_elapsed_us();
 
-static int cmp(const void *a, const void *b)
-{
-	const long long *aa = a, *bb = b;
+	tst_histogram_record(s->hist, val);
+
+	if (val < cur_usec) {
+		if (!s->early || val < s->early_min)
+			s->early_min = val;
+		if (!s->early || val > s->early_max)
+			s->early_max = val;
+		s->early++;
+	}
 
-	return *aa < *bb;
+	if (val > outliner_limit) {
+		if (!s->outliners || val < s->outliner_min)
+			s->outliner_min = val;
+		if (!s->outliners || val > s->outliner_max)
+			s->outliner_max = val;
+		s->outliners++;
+	}
+
+	if (sample_file)
+		fprintf(sample_file, "%lli\n", val);
 }
 
 /*
@@ -215,41 +262,172 @@ static unsigned int compute_discard(unsigned int nsamples)
 	return MAX(1u, nsamples / 20);
 }
 
-static void write_to_file(void)
+static void open_sample_file(void)
 {
-	unsigned int i;
-	FILE *f;
-
 	if (!file_name)
 		return;
 
-	f = fopen(file_name, "w");
+	sample_file = fopen(file_name, "w");
 
-	if (!f) {
+	if (!sample_file) {
 		tst_res(TWARN | TERRNO,
 			"Failed to open '%s'", file_name);
-		return;
 	}
+}
 
-	for (i = 0; i < cur_sample; i++)
-		fprintf(f, "%lli\n", samples[i]);
+static void close_sample_file(void)
+{
+	if (!sample_file)
+		return;
 
-	if (fclose(f)) {
+	if (fclose(sample_file)) {
 		tst_res(TWARN | TERRNO,
 			"Failed to close file '%s'", file_name);
 	}
+
+	sample_file = NULL;
+}
+
+static int run_samples(struct sampler *s, unsigned int nsamples)
+{
+	unsigned int i;
+
+	cur_sampler = s;
+
+	for (i = 0; i < nsamples; i++) {
+		if (sample(CLOCK_MONOTONIC, cur_usec))
+			return 1;
+	}
+
+	return 0;
+}
+
+static void *sample_thread(void *arg)
+{
+	struct sampler *s = arg;
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	CPU_SET(s->cpu, &set);
+
+	if (sched_setaffinity(0, sizeof(set), &set))
+		tst_res(TWARN | TERRNO, "Failed to move thread to CPU %i", s->cpu);
+
+	s->failed = run_samples(s, thread_samples);
+
+	return NULL;
+}
+
+/*
+ * Runs the sampling function nsamples times in each thread and merges the
+ * results into the hist histogram. Returns non-zero if the sampling function
+ * failed.
+ */
+static int take_samples(unsigned int nsamples)
+{
+	int i, failed = 0;
+
+	tst_histogram_reset(hist);
+
+	for (i = 0; i < threads; i++) {
+		tst_histogram_reset(samplers[i].hist);
+		samplers[i].early = 0;
+		samplers[i].outliners = 0;
+		samplers[i].failed = 0;
+	}
+
+	if (threads == 1) {
+		failed = run_samples(&samplers[0], nsamples);
+	} else {
+		thread_samples = nsamples;
+
+		for (i = 0; i < threads; i++) {
+			SAFE_PTHREAD_CREATE(&samplers[i].thread, NULL,
+					    sample_thread, &samplers[i]);
+		}
+
+		for (i = 0; i < threads; i++) {
+			SAFE_PTHREAD_JOIN(samplers[i].thread, NULL);
+			failed |= samplers[i].failed;
+		}
+	}
+
+	for (i = 0; i < threads; i++)
+		tst_histogram_merge(hist, samplers[i].hist);
+
+	return failed;
+}
+
+static void merge_counts(struct sampler *sum)
+{
+	struct sampler *s;
+	int i;
+
+	memset(sum, 0, sizeof(*sum));
+
+	for (i = 0; i < threads; i++) {
+		s = &samplers[i];
+
+		if (s->early) {
+			if (!sum->early || s->early_min < sum->early_min)
+				sum->early_min = s->early_min;
+			if (!sum->early || s->early_max > sum->early_max)
+				sum->early_max = s->early_max;
+			sum->early += s->early;
+		}
+
+		if (s->outliners) {
+			if (!sum->outliners || s->outliner_min < sum->outliner_min)
+				sum->outliner_min = s->outliner_min;
+			if (!sum->outliners || s->outliner_max > sum->outliner_max)
+				sum->outliner_max = s->outliner_max;
+			sum->outliners += s->outliners;
+		}
+	}
+}
+
+static void per_cpu_stats(void)
+{
+	struct tst_histogram *h;
+	int i;
+
+	if (threads == 1)
+		return;
+
+	for (i = 0; i < threads; i++) {
+		h = samplers[i].hist;
+
+		tst_res(TINFO,
+			"CPU %i: min %llius, max %llius, median %llius, p99 %llius",
+			samplers[i].cpu, h->min, h->max,
+			tst_histogram_percentile(h, 50),
+			tst_histogram_percentile(h, 99));
+	}
 }
 
+static void store_results(long long usec)
+{
+	char metric[64];
+
+	if (threads > 1)
+		snprintf(metric, sizeof(metric), "%llius_%ithreads", usec, threads);
+	else
+		snprintf(metric, sizeof(metric), "%llius", usec);
+
+	tst_bench_store(metric, hist);
+}
 
 /*
  * Timer testing function.
  *
  * What we do here is:
  *
- * * Take nsamples measurements of the timer function, the function
- *   to be sampled is defined in the the actual test.
+ * * Take nsamples measurements of the timer function in each sampling thread,
+ *   the function to be sampled is defined in the the actual test. The samples
+ *   are recorded into a histogram, so the memory does not grow with the
+ *   number of samples.
  *
- * * We sort the array of samples, then:
+ * * Then we:
  *
  *   - look for outliners which are samples where the sleep time has exceeded
  *     requested sleep time by an order of magnitude and, at the same time, are
@@ -264,60 +442,67 @@ static void write_to_file(void)
 void do_timer_test(long long usec, unsigned int nsamples)
 {
 	long long trunc_mean, median;
-	unsigned int discard = compute_discard(nsamples);
-	unsigned int keep_samples = nsamples - discard;
+	unsigned int total = nsamples * threads;
+	unsigned int discard = compute_discard(total);
+	unsigned int keep_samples = total - discard;
 	long long threshold = compute_threshold(usec, keep_samples);
-	int i;
+	struct sampler sum;
 	int failed = 0;
 
-	tst_res(TINFO,
-		"%s sleeping for %llius %u iterations, threshold %.2fus",
-		scall, usec, nsamples, 1.00 * threshold / (keep_samples));
-
-	cur_sample = 0;
-	for (i = 0; i < (int)nsamples; i++) {
-		if (sample(CLOCK_MONOTONIC, usec)) {
-			tst_res(TINFO, "sampling function failed, exitting");
-			return;
-		}
+	if (threads > 1) {
+		tst_res(TINFO,
+			"%s sleeping for %llius %u iterations in %i threads, threshold %.2fus",
+			scall, usec, nsamples, threads,
+			1.00 * threshold / (keep_samples));
+	} else {
+		tst_res(TINFO,
+			"%s sleeping for %llius %u iterations, threshold %.2fus",
+			scall, usec, nsamples, 1.00 * threshold / (keep_samples));
 	}
 
-	qsort(samples, nsamples, sizeof(samples[0]), cmp);
+	cur_usec = usec;
+	outliner_limit = MAX(10 * usec, 3LL * monotonic_resolution);
 
-	write_to_file();
+	open_sample_file();
+	failed = take_samples(nsamples);
+	close_sample_file();
 
-	for (i = 0; samples[i] > 10 * usec && i < (int)nsamples; i++) {
-		if (samples[i] <= 3 * monotonic_resolution)
-			break;
+	if (failed) {
+		tst_res(TINFO, "sampling function failed, exitting");
+		return;
 	}
 
-	if (i > 0) {
-		tst_res(TINFO, "Found %i outliners in [%lli,%lli] range",
-			i, samples[0], samples[i-1]);
-	}
+	merge_counts(&sum);
 
-	for (i = nsamples - 1; samples[i] < usec && i > -1; i--);
+	if (sum.outliners) {
+		tst_res(TINFO, "Found %u outliners in [%lli,%lli] range",
+			sum.outliners, sum.outliner_min, sum.outliner_max);
+	}
 
-	if (i < (int)nsamples - 1) {
+	if (sum.early) {
 		tst_res(TFAIL, "%s woken up early %u times range: [%lli,%lli]",
-			scall, nsamples - 1 - i,
-			samples[i+1], samples[nsamples-1]);
+			scall, sum.early, sum.early_min, sum.early_max);
 		failed = 1;
 	}
 
-	median = samples[nsamples/2];
-
-	trunc_mean = 0;
+	median = tst_histogram_percentile(hist, 50);
 
-	for (i = discard; i < (int)nsamples; i++)
-		trunc_mean += samples[i];
+	trunc_mean = hist->sum - tst_histogram_sum_top(hist, discard);
 
 	tst_res(TINFO,
 		"min %llius, max %llius, median %llius, trunc mean %.2fus (discarded %u)",
-		samples[nsamples-1], samples[0], median,
+		hist->min, hist->max, median,
 		1.00 * trunc_mean / keep_samples, discard);
 
-	if (trunc_mean > (nsamples - discard) * usec + threshold) {
+	tst_res(TINFO, "p90 %llius, p99 %llius, p99.9 %llius",
+		tst_histogram_percentile(hist, 90),
+		tst_histogram_percentile(hist, 99),
+		tst_histogram_percentile(hist, 99.9));
+
+	per_cpu_stats();
+	store_results(usec);
+
+	if (trunc_mean > keep_samples * usec + threshold) {
 		tst_res(TFAIL, "%s slept for too long", scall);
 
 		if (!print_frequency_plot)
@@ -346,6 +531,37 @@ static int set_latency(void)
         return write(fd, &latency, sizeof(latency));
 }
 
+/*
+ * The sampling threads are spread over the CPUs the test is allowed to run
+ * on, the single threaded sampling stays where the scheduler puts it.
+ */
+static void setup_samplers(void)
+{
+	cpu_set_t set;
+	int i, cpu = -1, ncpus;
+
+	samplers = SAFE_MALLOC(sizeof(*samplers) * threads);
+
+	if (sched_getaffinity(0, sizeof(set), &set))
+		tst_brk(TBROK | TERRNO, "sched_getaffinity()");
+
+	ncpus = CPU_COUNT(&set);
+
+	if (threads > ncpus) {
+		tst_res(TINFO, "%i sampling threads on %i CPUs", threads,
+			ncpus);
+	}
+
+	for (i = 0; i < threads; i++) {
+		do {
+			cpu = (cpu + 1) % CPU_SETSIZE;
+		} while (!CPU_ISSET(cpu, &set));
+
+		samplers[i].cpu = cpu;
+		samplers[i].hist = tst_histogram_alloc();
+	}
+}
+
 static void timer_setup(void)
 {
 	struct timespec t;
@@ -374,7 +590,8 @@ static void timer_setup(void)
 
 	parse_timer_opts();
 
-	samples = SAFE_MALLOC(sizeof(long long) * MAX(MAX_SAMPLES, sample_cnt));
+	hist = tst_histogram_alloc();
+	setup_samplers();
 
 	if (set_latency() < 0)
 		tst_res(TINFO, "Failed to set zero latency constraint: %m");
@@ -385,7 +602,16 @@ static void timer_setup(void)
 
 static void timer_cleanup(void)
 {
-	free(samples);
+	int i;
+
+	if (samplers) {
+		for (i = 0; i < threads; i++)
+			tst_histogram_free(samplers[i].hist);
+
+		free(samplers);
+	}
+
+	tst_histogram_free(hist);
 
 	if (cleanup)
 		cleanup();
@@ -419,6 +645,7 @@ static struct tst_option options[] = {
 	{"s:", &str_sleep_time, "-s us    Sleep time"},
 	{"n:", &str_sample_cnt, "-n uint  Number of samples to take"},
 	{"f:", &file_name, "-f fname Write measured samples into a file"},
+	{"t:", &str_threads, "-t uint  Sample in n threads, each on a different CPU"},
 	{NULL, NULL, NULL}
 };
 
@@ -438,6 +665,13 @@ static void parse_timer_opts(void)
 		}
 	}
 
+	if (str_threads) {
+		if (tst_parse_int(str_threads, &threads, 1, CPU_SETSIZE)) {
+			tst_brk(TBROK,
+				"Invalid number of threads '%s'", str_threads);
+		}
+	}
+
 	if (str_sleep_time || str_sample_cnt) {
 		if (sleep_time < 0)
 			sleep_time = 10000;
@@ -470,6 +704,8 @@ struct tst_test *tst_timer_test_setup(struct tst_test *timer_test)
 	timer_test->sample = NULL;
 	timer_test->options = options;
 
+	tst_bench_parse_threshold();
+
 	test = timer_test;
 
 	return timer_test;
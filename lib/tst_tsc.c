@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ * Copyright (c) 2019 Linux Test Project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+# include <cpuid.h>
+#endif
+
+#define TST_NO_DEFAULT_MAIN
+#include "tst_test.h"
+#include "tst_tsc.h"
+
+#define CALIBRATE_US 20000
+#define SAMPLE_TRIES 16
+#define CLOCKSOURCES \
+	"/sys/devices/system/clocksource/clocksource0/available_clocksource"
+
+struct tst_tsc tst_tsc;
+
+static uint64_t mono_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Reads the counter between two CLOCK_MONOTONIC reads, the pair closest
+ * together is used and the counter is matched with the middle of it.
+ */
+static void sample(uint64_t *cycles, uint64_t *ns)
+{
+	uint64_t t0, t1, c, best = UINT64_MAX;
+	int i;
+
+	for (i = 0; i < SAMPLE_TRIES; i++) {
+		t0 = mono_ns();
+		c = tst_tsc_read();
+		t1 = mono_ns();
+
+		if (t1 - t0 < best) {
+			best = t1 - t0;
+			*cycles = c;
+			*ns = t0 + (t1 - t0) / 2;
+		}
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/*
+ * The kernel drops TSC from the clocksources once it finds it unstable, e.g.
+ * not synchronized between CPUs.
+ */
+static int kernel_trusts_tsc(void)
+{
+	char buf[256];
+	FILE *f;
+	int ret = 1;
+
+	f = fopen(CLOCKSOURCES, "r");
+	if (!f)
+		return 1;
+
+	if (fgets(buf, sizeof(buf), f) && !strstr(buf, "tsc")) {
+		tst_res(TINFO, "TSC is not a clocksource, kernel found it unstable");
+		ret = 0;
+	}
+
+	fclose(f);
+	return ret;
+}
+
+static int counter_usable(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)
+	    || !(edx & (1 << 8))) {
+		tst_res(TINFO, "TSC is not invariant");
+		return 0;
+	}
+
+	return kernel_trusts_tsc();
+}
+#elif defined(__aarch64__)
+static int counter_usable(void)
+{
+	/* The generic timer runs at constant rate by definition */
+	return 1;
+}
+#else
+static int counter_usable(void)
+{
+	tst_res(TINFO, "No cycle counter support on this architecture");
+	return 0;
+}
+#endif
+
+int tst_tsc_init(void)
+{
+	uint64_t c0, c1, t0, t1;
+	double ns_per_cycle, mhz;
+	unsigned int shift;
+	long long err;
+
+	if (!getenv("LTP_TSC") || tst_tsc.enabled)
+		return !tst_tsc.enabled;
+
+	if (!counter_usable())
+		return 1;
+
+	sample(&c0, &t0);
+	usleep(CALIBRATE_US);
+	sample(&c1, &t1);
+
+	if (c1 <= c0) {
+		tst_res(TINFO, "Cycle counter does not advance");
+		return 1;
+	}
+
+	ns_per_cycle = (double)(t1 - t0) / (c1 - c0);
+	mhz = 1000 / ns_per_cycle;
+
+	if (mhz < 1 || mhz > 100000) {
+		tst_res(TINFO, "Cycle counter frequency %.3f MHz is bogus", mhz);
+		return 1;
+	}
+
+	/* The largest shift that keeps mult in 32 bits */
+	for (shift = 32; shift > 0; shift--) {
+		if (ns_per_cycle * (1ULL << shift) < 4294967296.0)
+			break;
+	}
+
+	tst_tsc.mult = ns_per_cycle * (1ULL << shift) + 0.5;
+	tst_tsc.shift = shift;
+	tst_tsc.base_cycles = c1;
+	tst_tsc.base_ns = t1;
+	tst_tsc.enabled = 1;
+
+	usleep(CALIBRATE_US);
+	sample(&c1, &t1);
+	err = tst_tsc_ns(c1) - t1;
+
+	tst_res(TINFO, "Using cycle counter time source, %.3f MHz, "
+		"drift against CLOCK_MONOTONIC after %ims is %llins", mhz,
+		CALIBRATE_US / 1000, err);
+
+	return 0;
+}
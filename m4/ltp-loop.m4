@@ -0,0 +1,8 @@
+dnl SPDX-License-Identifier: GPL-2.0-or-later
+
+dnl LTP_CHECK_LOOP
+dnl ----------------------------
+AC_DEFUN([LTP_CHECK_LOOP],[
+AC_CHECK_TYPES([struct loop_config],,,[#include <linux/loop.h>])
+AC_CHECK_DECLS([LO_FLAGS_DIRECT_IO],,,[#include <linux/loop.h>])
+])
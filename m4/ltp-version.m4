@@ -0,0 +1 @@
+20190115])